@@ -48,6 +48,12 @@ std::tuple<double, double> mergerCosts(double costCPU, double costRAM, size_t R,
 std::tuple<size_t, double, double> cheapestMergers(double costCPU, double costRAM, int parallelism, int mosSize,
                                                    double cycleDuration, std::function<double(double)> performance);
 
+// Returns the reduction factor of the cheapest merger topology, for a merger performance (merged objects per second)
+// which does not depend on the number of inputs. The default costs are the ones of runMergerCalculator.
+// 0 is returned if none of the topologies can merge the objects as fast as they arrive.
+size_t cheapestReductionFactor(int parallelism, int mosSize, double cycleDuration, double mergerPerformance,
+                               double costCPU = 118.0, double costRAM = 0.0065);
+
 double qcTaskInputMemory(double utilisation, double avgInputMessage, double stddevInputMessage);
 
 double qcTaskCost(double costCPU, double costRAM, double qcTaskCPU, size_t qcTaskRAM, double parallelData, double avgInputMessage, double stddevInputMessage);
@@ -194,11 +194,14 @@ class InfrastructureGenerator
   static void generateMergers(framework::WorkflowSpec& workflow,
                               std::string taskName,
                               size_t numberOfLocalMachines,
+                              size_t reductionFactor,
                               double cycleDurationSeconds,
                               std::string mergingMode,
                               size_t resetAfterCycles,
                               std::string monitoringUrl,
                               std::string detectorName);
+  /// \brief Returns the number of inputs per Merger, the Mergers are on one layer if it is not smaller than the number of machines
+  static size_t computeMergersReductionFactor(const TaskSpec& taskSpec, size_t numberOfLocalMachines, double cycleDurationSeconds);
   static void generateCheckRunners(framework::WorkflowSpec& workflow, const InfrastructureSpec& infrastructureSpec);
   static void generateAggregator(framework::WorkflowSpec& workflow, const InfrastructureSpec& infrastructureSpec);
   static void generatePostProcessing(framework::WorkflowSpec& workflow, const InfrastructureSpec& infrastructureSpec);
@@ -23,6 +23,7 @@
 #include "QualityControl/CheckSpec.h"
 #include "QualityControl/PostProcessingTaskSpec.h"
 #include <boost/property_tree/ptree_fwd.hpp>
+#include <cstdint>
 
 namespace o2::quality_control::core
 {
@@ -33,8 +34,25 @@ namespace o2::quality_control::core
 
 namespace InfrastructureSpecReader
 {
+/// \brief Sections of the QC configuration, they can be combined to read only some of them.
+enum Section : uint8_t {
+  CommonSection = 1 << 0,
+  TasksSection = 1 << 1,
+  ChecksSection = 1 << 2,
+  AggregatorsSection = 1 << 3,
+  PostProcessingSection = 1 << 4,
+  ExternalTasksSection = 1 << 5,
+  AllSections = 0xff
+};
+
 /// \brief Reads the full QC configuration structure.
 InfrastructureSpec readInfrastructureSpec(const boost::property_tree::ptree& wholeTree);
+/// \brief Reads only the given sections of the QC configuration, the other ones are left empty.
+///
+/// A device refreshing its configuration needs the common section and its own one at most. Reading the other ones
+/// means e.g. resolving the data sources of all the checks or copying the whole tree for each post-processing task,
+/// which adds up when hundreds of devices start on the same node.
+InfrastructureSpec readInfrastructureSpec(const boost::property_tree::ptree& wholeTree, uint8_t sections);
 
 template <typename T>
 T readSpecEntry(std::string entryID, const boost::property_tree::ptree& entryTree, const boost::property_tree::ptree& wholeTree);
@@ -55,22 +73,30 @@ ExternalTaskSpec readSpecEntry<ExternalTaskSpec>(std::string entryID, const boos
 template <>
 CommonSpec readSpecEntry<CommonSpec>(std::string entryID, const boost::property_tree::ptree& entryTree, const boost::property_tree::ptree& wholeTree);
 
-// todo: section names should be enum.
-template <typename T>
-std::vector<T> readSectionSpec(const boost::property_tree::ptree& wholeTree, const std::string& section)
+/// \brief Reads the entries of a section for which isNeeded(entryID, entryTree) returns true.
+/// The other entries are not parsed at all, thus they may also be incomplete.
+template <typename T, typename Predicate>
+std::vector<T> readSectionSpec(const boost::property_tree::ptree& wholeTree, const std::string& section, Predicate isNeeded)
 {
   const auto& qcTree = wholeTree.get_child("qc");
   std::vector<T> sectionSpec;
   if (qcTree.find(section) != qcTree.not_found()) {
     const auto& sectionTree = qcTree.get_child(section);
-    sectionSpec.reserve(sectionTree.size());
     for (const auto& [entryID, entryTree] : sectionTree) {
-      sectionSpec.push_back(readSpecEntry<T>(entryID, entryTree, wholeTree));
+      if (isNeeded(entryID, entryTree)) {
+        sectionSpec.push_back(readSpecEntry<T>(entryID, entryTree, wholeTree));
+      }
     }
   }
   return sectionSpec;
 }
 
+template <typename T>
+std::vector<T> readSectionSpec(const boost::property_tree::ptree& wholeTree, const std::string& section)
+{
+  return readSectionSpec<T>(wholeTree, section, [](const std::string&, const boost::property_tree::ptree&) { return true; });
+}
+
 std::string validateDetectorName(std::string name);
 
 } // namespace InfrastructureSpecReader
@@ -31,6 +31,7 @@ namespace o2::quality_control::core
 {
 
 class ServiceDiscovery;
+class TimingProbes;
 
 /// \brief  Keeps the list of encapsulated objects to publish and does the actual publication.
 ///
@@ -177,6 +178,9 @@ class ObjectsManager
   const Activity& getActivity() const;
   void setActivity(const Activity& activity);
 
+  /// \brief Returns the timing probes of the task, published by the TaskRunner at the end of each cycle.
+  TimingProbes& getTimingProbes();
+
  private:
   std::unique_ptr<MonitorObjectCollection> mMonitorObjects;
   std::string mTaskName;
@@ -185,6 +189,7 @@ class ObjectsManager
   std::unique_ptr<ServiceDiscovery> mServiceDiscovery;
   bool mUpdateServiceDiscovery;
   Activity mActivity;
+  std::unique_ptr<TimingProbes> mTimingProbes;
 };
 
 } // namespace o2::quality_control::core
@@ -64,6 +64,20 @@ class PostProcessingInterface
   /// \param services Interface containing optional interfaces, for example DatabaseInterface
   virtual void finalize(Trigger trigger, framework::ServiceRegistry& services) = 0;
 
+  /// \brief Optional retrieval of inputs ahead of an update.
+  /// When running over a set of timestamps with parallelism larger than one, the runner calls this method
+  /// from a worker thread for the upcoming triggers, while update() for an earlier trigger may still be running.
+  /// It should only retrieve and prepare the inputs which update() will need for the same trigger,
+  /// thus it has to be safe to call concurrently with update() and with other prefetch() calls.
+  /// \param trigger  Trigger which will be later given to update()
+  /// \param services Interface containing optional interfaces, for example DatabaseInterface
+  virtual void prefetch(Trigger trigger, framework::ServiceRegistry& services);
+  /// \brief Declares whether the results of update() depend on the preceding updates.
+  /// If true, the runner is allowed to run updates for different timestamps in parallel, each in a separate instance
+  /// of the task, and to publish the results in the timestamp order. Such tasks should not accumulate state across
+  /// updates and must not rely on resources shared between the instances without synchronisation.
+  virtual bool isOrderIndependent() const;
+
   void setObjectsManager(std::shared_ptr<core::ObjectsManager> objectsManager);
   void setName(const std::string& name);
   std::string getName() const;
@@ -74,7 +74,11 @@ class PostProcessingRunner
   ///
   /// \param t A vector with timestamps (ms since epoch).
   ///          The first is used for task initialisation, the last for task finalisation, so at least two are required.
-  void runOverTimestamps(const std::vector<uint64_t>& t);
+  /// \param parallelism How many update timestamps may be processed at once. With 1 (default), updates are executed
+  ///          strictly in sequence. With more, inputs of the next timestamps are prefetched while the current update
+  ///          runs. If the task declares itself as order-independent, the updates are also executed in parallel in
+  ///          separate task instances. In all cases the objects are published in the timestamp order.
+  void runOverTimestamps(const std::vector<uint64_t>& t, size_t parallelism = 1);
 
   /// \brief Set how objects should be published. If not used, objects will be stored in repository.
   ///
@@ -89,6 +93,18 @@ class PostProcessingRunner
   void doInitialize(Trigger trigger);
   void doUpdate(Trigger trigger);
   void doFinalize(Trigger trigger);
+  void publish(o2::quality_control::core::ObjectsManager& objectsManager, uint64_t timestamp);
+
+  /// \brief An additional instance of the user task, used to run order-independent updates in parallel.
+  struct TaskReplica {
+    std::unique_ptr<PostProcessingInterface> task;
+    std::shared_ptr<o2::quality_control::core::ObjectsManager> objectsManager;
+    std::shared_ptr<o2::quality_control::repository::DatabaseInterface> database;
+    framework::ServiceRegistry services;
+  };
+  std::unique_ptr<TaskReplica> createReplica();
+  void runOverTimestampsPipelined(const std::vector<uint64_t>& t, size_t depth);
+  void runOverTimestampsInParallel(const std::vector<uint64_t>& t, size_t parallelism);
 
   enum class TaskState {
     INVALID,
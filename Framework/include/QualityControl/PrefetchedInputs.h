@@ -0,0 +1,66 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file    PrefetchedInputs.h
+///
+
+#ifndef QUALITYCONTROL_PREFETCHEDINPUTS_H
+#define QUALITYCONTROL_PREFETCHEDINPUTS_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+
+namespace o2::quality_control::postprocessing
+{
+
+/// \brief Inputs of a post-processing task retrieved by prefetch(), kept until update() takes them.
+///
+/// prefetch() may be called from several threads at the same time, thus the accesses are synchronised.
+template <typename Inputs>
+class PrefetchedInputs
+{
+ public:
+  void put(uint64_t timestamp, Inputs inputs)
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mInputs[timestamp] = std::move(inputs);
+  }
+
+  /// \brief Returns the inputs prefetched for the timestamp, if any, and forgets them
+  std::optional<Inputs> take(uint64_t timestamp)
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mInputs.find(timestamp);
+    if (it == mInputs.end()) {
+      return std::nullopt;
+    }
+    std::optional<Inputs> inputs{ std::move(it->second) };
+    mInputs.erase(it);
+    return inputs;
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mInputs.clear();
+  }
+
+ private:
+  std::mutex mMutex;
+  std::map<uint64_t, Inputs> mInputs;
+};
+
+} // namespace o2::quality_control::postprocessing
+
+#endif // QUALITYCONTROL_PREFETCHEDINPUTS_H
@@ -20,6 +20,10 @@
 #include <InfoLogger/InfoLogger.hxx>
 #include <InfoLogger/InfoLoggerMacros.hxx>
 #include <boost/property_tree/ptree_fwd.hpp>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
 
 typedef AliceO2::InfoLogger::InfoLogger infologger; // not to have to type the full stuff each time
 typedef AliceO2::InfoLogger::InfoLoggerContext infoContext;
@@ -38,6 +42,10 @@ namespace o2::quality_control::core
 ///           ILOG_INST << InfoLogger::InfoLoggerMessageOption{ InfoLogger::Fatal, 1, 1, "asdf", 3 }
 ///                     << "fatal message with extra fields" << ENDM; // complex version
 ///           ILOG(Info, Ops) << "Test message with severity Info and level Ops, see InfoLoggerMacros.hxx" << ENDM;
+///           ILOG_RATE_LIMITED(Warning, Support, 10, 60) << "at most 10 such messages per minute" << ENDM;
+///
+/// The messages of ILOG are not formatted at all if they are discarded by the filters given to init().
+/// If QC_INFOLOGGER_DISCARD_DEBUG is defined at compile time, the Debug and Trace messages are removed from the code.
 ///
 /// \author Barthelemy von Haller
 class QcInfoLogger
@@ -73,6 +81,27 @@ class QcInfoLogger
                    int run = -1,
                    const std::string& partitionName = "");
 
+  /// \brief Tells if a message would pass the discard filters set with init(), without formatting it
+  ///
+  /// If the discarded messages go to a file, all of them are reported as enabled and the InfoLogger filters them.
+  static bool isEnabled(AliceO2::InfoLogger::InfoLogger::Severity severity, int level)
+  {
+    return !(severity == AliceO2::InfoLogger::InfoLogger::Severity::Debug && mDiscardDebug.load(std::memory_order_relaxed)) &&
+           level < mDiscardFromLevel.load(std::memory_order_relaxed);
+  }
+
+  /// \brief Tells if a message is kept at compile time, see QC_INFOLOGGER_DISCARD_DEBUG
+  static constexpr bool isCompiledIn(AliceO2::InfoLogger::InfoLogger::Severity severity, int level)
+  {
+#ifdef QC_INFOLOGGER_DISCARD_DEBUG
+    return severity != AliceO2::InfoLogger::InfoLogger::Severity::Debug && level < AliceO2::InfoLogger::InfoLogger::Level::Trace;
+#else
+    (void)severity;
+    (void)level;
+    return true;
+#endif
+  }
+
   // build a default infologger
   static class _init
   {
@@ -92,6 +121,67 @@ class QcInfoLogger
   // if we keep the default infologger it will any ways be valid till the end of the process.
   static AliceO2::InfoLogger::InfoLogger* instance;
   static AliceO2::InfoLogger::InfoLoggerContext* mContext;
+  // copies of the discard filters of the InfoLogger, nothing is discarded until init() is called.
+  // They are read by the ILOG macros of any thread, while init() may set them.
+  static std::atomic<bool> mDiscardDebug;
+  static std::atomic<int> mDiscardFromLevel;
+};
+
+/// \brief Limits the number of messages logged by a call site, see ILOG_RATE_LIMITED.
+///
+/// At most maxMessages are let through in each period, the other ones are counted and their number is reported
+/// with the next message which is let through. It can be used by several threads at the same time.
+class LogRateLimiter
+{
+ public:
+  /// \brief Returned by acquire(), tells if the message can be logged and how many were suppressed before it
+  struct Permit {
+    bool allowed = false;
+    uint64_t suppressed = 0;
+
+    explicit operator bool() const { return allowed; }
+    void release() { allowed = false; }
+  };
+
+  LogRateLimiter(uint32_t maxMessages, double periodSeconds)
+    : mMaxMessages(maxMessages),
+      mPeriod(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(periodSeconds)))
+  {
+  }
+
+  Permit acquire()
+  {
+    auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto windowStart = mWindowStart.load(std::memory_order_relaxed);
+    if (now - windowStart >= mPeriod.count() && mWindowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed)) {
+      mCount.store(0, std::memory_order_relaxed);
+    }
+    if (mCount.fetch_add(1, std::memory_order_relaxed) < mMaxMessages) {
+      return { true, mSuppressed.exchange(0, std::memory_order_relaxed) };
+    }
+    mSuppressed.fetch_add(1, std::memory_order_relaxed);
+    return {};
+  }
+
+ private:
+  const uint32_t mMaxMessages;
+  const std::chrono::steady_clock::duration mPeriod;
+  std::atomic<std::chrono::steady_clock::rep> mWindowStart{ std::chrono::steady_clock::rep{ LLONG_MIN / 2 } };
+  std::atomic<uint32_t> mCount{ 0 };
+  std::atomic<uint64_t> mSuppressed{ 0 };
+};
+
+inline AliceO2::InfoLogger::InfoLogger& operator<<(AliceO2::InfoLogger::InfoLogger& log, const LogRateLimiter::Permit& permit)
+{
+  if (permit.suppressed > 0) {
+    log << "(" << permit.suppressed << " similar messages suppressed) ";
+  }
+  return log;
+}
+
+/// \brief Lets the ILOG macros discard a whole message in one expression, taking the place of the stream in a ternary
+struct LogVoidify {
+  void operator&(AliceO2::InfoLogger::InfoLogger&) {}
 };
 
 } // namespace o2::quality_control::core
@@ -115,11 +205,36 @@ class QcInfoLogger
 #define ILOG(...) VA_MACRO(ILOG, void, void, __VA_ARGS__)
 // TODO understand why the zero argument does not work.
 // the code is derived from https://stackoverflow.com/questions/16683146/can-macros-be-overloaded-by-number-of-arguments
-#define ILOG0(s, t) \
-  ILOG_INST << AliceO2::InfoLogger::InfoLogger::InfoLoggerMessageOption { AliceO2::InfoLogger::InfoLogger::Severity::Info, AliceO2::InfoLogger::InfoLogger::Level::Support, AliceO2::InfoLogger::InfoLogger::undefinedMessageOption.errorCode, __FILE__, __LINE__ }
-#define ILOG1(s, t, severity) \
-  ILOG_INST << AliceO2::InfoLogger::InfoLogger::InfoLoggerMessageOption { AliceO2::InfoLogger::InfoLogger::Severity::severity, AliceO2::InfoLogger::InfoLogger::Level::Support, AliceO2::InfoLogger::InfoLogger::undefinedMessageOption.errorCode, __FILE__, __LINE__ }
-#define ILOG2(s, t, severity, level) \
-  ILOG_INST << AliceO2::InfoLogger::InfoLogger::InfoLoggerMessageOption { AliceO2::InfoLogger::InfoLogger::Severity::severity, AliceO2::InfoLogger::InfoLogger::Level::level, AliceO2::InfoLogger::InfoLogger::undefinedMessageOption.errorCode, __FILE__, __LINE__ }
+#define ILOG0(s, t) ILOG_SEVERITY_LEVEL(Info, Support)
+#define ILOG1(s, t, severity) ILOG_SEVERITY_LEVEL(severity, Support)
+#define ILOG2(s, t, severity, level) ILOG_SEVERITY_LEVEL(severity, level)
+
+#define ILOG_MESSAGE_OPTION(severity, level)                                                \
+  AliceO2::InfoLogger::InfoLogger::InfoLoggerMessageOption                                  \
+  {                                                                                         \
+    AliceO2::InfoLogger::InfoLogger::Severity::severity,                                    \
+      AliceO2::InfoLogger::InfoLogger::Level::level,                                        \
+      AliceO2::InfoLogger::InfoLogger::undefinedMessageOption.errorCode, __FILE__, __LINE__ \
+  }
+#define ILOG_ENABLED(severity, level)                                                                                                                           \
+  (o2::quality_control::core::QcInfoLogger::isCompiledIn(AliceO2::InfoLogger::InfoLogger::Severity::severity, AliceO2::InfoLogger::InfoLogger::Level::level) && \
+   o2::quality_control::core::QcInfoLogger::isEnabled(AliceO2::InfoLogger::InfoLogger::Severity::severity, AliceO2::InfoLogger::InfoLogger::Level::level))
+
+// the stream is only evaluated if the message is kept, thus the arguments of a discarded message are not even formatted
+#define ILOG_SEVERITY_LEVEL(severity, level) \
+  !ILOG_ENABLED(severity, level) ? (void)0 : o2::quality_control::core::LogVoidify() & ILOG_INST << ILOG_MESSAGE_OPTION(severity, level)
+
+// Logs at most maxMessages per periodSeconds from this call site, the arguments have to be constants.
+// The number of messages which were suppressed is added at the beginning of the next message which is logged.
+#define ILOG_RATE_LIMITER(maxMessages, periodSeconds)                                       \
+  ([]() -> o2::quality_control::core::LogRateLimiter& {                                     \
+    static o2::quality_control::core::LogRateLimiter limiter{ maxMessages, periodSeconds }; \
+    return limiter;                                                                         \
+  }())
+#define ILOG_RATE_LIMITED(severity, level, maxMessages, periodSeconds)                                             \
+  for (auto _qcLogPermit = ILOG_ENABLED(severity, level) ? ILOG_RATE_LIMITER(maxMessages, periodSeconds).acquire() \
+                                                         : o2::quality_control::core::LogRateLimiter::Permit{};    \
+       _qcLogPermit; _qcLogPermit.release())                                                                       \
+  ILOG_INST << ILOG_MESSAGE_OPTION(severity, level) << _qcLogPermit
 
 #endif // QC_CORE_QCINFOLOGGER_H
@@ -0,0 +1,177 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   RawPageDispatcher.h
+///
+
+#ifndef QC_CORE_RAWPAGEDISPATCHER_H
+#define QC_CORE_RAWPAGEDISPATCHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <DPLUtils/DPLRawParser.h>
+#include <DetectorsRaw/RDHUtils.h>
+#include <Framework/InputRecord.h>
+#include <Headers/DataHeader.h>
+
+namespace o2::quality_control::core
+{
+
+/// \brief A page of raw data, as seen by the callbacks of the RawPageDispatcher
+struct RawPage {
+  const o2::header::DataHeader* dataHeader = nullptr; ///< header of the message containing the page
+  const char* raw = nullptr;                          ///< start of the page, i.e. of the RDH
+  const char* payload = nullptr;                      ///< start of the payload, after the RDH
+  size_t payloadSize = 0;                             ///< size of the payload
+  uint16_t feeId = 0;
+  uint8_t linkId = 0;
+};
+
+/// \brief Processes the raw pages of a TF with several threads, each with its own state.
+///
+/// The pages are assigned to the workers according to their FEE ID and link ID, thus the pages of a given
+/// link are always processed by the same worker and in the order they were received. Each worker owns a
+/// State object, which is the only thing it may modify besides what it captured by reference in a
+/// thread-safe way. The states are given back to the task with merge(), in the order of the workers,
+/// so that the result does not depend on the scheduling of the threads.
+///
+/// Typical usage in a task:
+/// \code
+/// // in initialize()
+/// mDispatcher = std::make_unique<RawPageDispatcher<MyState>>(nWorkers);
+/// // in monitorData()
+/// mDispatcher->process(ctx.inputs(), [](const RawPage& page, MyState& state) { ... });
+/// mDispatcher->merge([this](MyState& state) { ... fill the histograms ... });
+/// \endcode
+template <typename State>
+class RawPageDispatcher
+{
+ public:
+  /// \param nWorkers number of workers, 1 processes all pages in the calling thread
+  /// \param makeState factory of the worker states, also used to reset them after merge()
+  explicit RawPageDispatcher(size_t nWorkers = 1, std::function<State()> makeState = [] { return State{}; })
+    : mMakeState(std::move(makeState)), mPages(nWorkers > 0 ? nWorkers : 1)
+  {
+    for (size_t i = 0; i < mPages.size(); i++) {
+      mStates.push_back(mMakeState());
+    }
+  }
+
+  /// \brief Calls processPage(const RawPage&, State&) for each raw page of the inputs matching the filter.
+  /// An exception thrown by a callback is rethrown in the calling thread, after all the workers are done.
+  template <typename PageCallback>
+  void process(o2::framework::InputRecord& inputs, PageCallback&& processPage, std::vector<o2::framework::InputSpec> filter = {})
+  {
+    clearPages();
+    o2::framework::DPLRawParser parser(inputs, filter);
+    for (auto it = parser.begin(), end = parser.end(); it != end; ++it) {
+      RawPage page;
+      page.dataHeader = it.o2DataHeader();
+      page.raw = reinterpret_cast<const char*>(it.raw());
+      page.payload = reinterpret_cast<const char*>(it.data());
+      page.payloadSize = it.size();
+      page.feeId = o2::raw::RDHUtils::getFEEID(page.raw);
+      page.linkId = o2::raw::RDHUtils::getLinkID(page.raw);
+      assign(page);
+    }
+    run(std::forward<PageCallback>(processPage));
+  }
+
+  /// \brief Same as process(), for pages which were already extracted from the inputs
+  template <typename PageCallback>
+  void process(const std::vector<RawPage>& pages, PageCallback&& processPage)
+  {
+    clearPages();
+    for (const auto& page : pages) {
+      assign(page);
+    }
+    run(std::forward<PageCallback>(processPage));
+  }
+
+  /// \brief Calls merge(State&) for the state of each worker, in the order of the workers, then resets the states
+  template <typename MergeCallback>
+  void merge(MergeCallback&& merge)
+  {
+    for (auto& state : mStates) {
+      merge(state);
+      state = mMakeState();
+    }
+  }
+
+  size_t getNumberOfWorkers() const { return mStates.size(); }
+  const State& getState(size_t worker) const { return mStates.at(worker); }
+
+  /// \brief Returns the worker processing the pages of a link
+  size_t getWorker(uint16_t feeId, uint8_t linkId) const
+  {
+    return ((static_cast<size_t>(feeId) << 8) | linkId) % mPages.size();
+  }
+
+ private:
+  void clearPages()
+  {
+    for (auto& pages : mPages) {
+      pages.clear();
+    }
+  }
+
+  void assign(const RawPage& page)
+  {
+    mPages[getWorker(page.feeId, page.linkId)].push_back(page);
+  }
+
+  template <typename PageCallback>
+  void run(PageCallback&& processPage)
+  {
+    std::vector<std::exception_ptr> errors(mPages.size());
+    auto work = [&](size_t worker) {
+      try {
+        for (const auto& page : mPages[worker]) {
+          processPage(page, mStates[worker]);
+        }
+      } catch (...) {
+        errors[worker] = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t worker = 1; worker < mPages.size(); worker++) {
+      if (!mPages[worker].empty()) {
+        threads.emplace_back(work, worker);
+      }
+    }
+    work(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (auto& error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+  std::function<State()> mMakeState;
+  std::vector<std::vector<RawPage>> mPages;
+  std::vector<State> mStates;
+};
+
+} // namespace o2::quality_control::core
+
+#endif // QC_CORE_RAWPAGEDISPATCHER_H
@@ -23,6 +23,7 @@
 #include "QualityControl/SliceReductor.h"
 #include "QualityControl/SliceInfoTrending.h"
 #include "QualityControl/SliceTrendingTaskConfig.h"
+#include "QualityControl/PrefetchedInputs.h"
 
 #include <memory>
 #include <map>
@@ -37,6 +38,11 @@ namespace o2::quality_control::repository
 class DatabaseInterface;
 } // namespace o2::quality_control::repository
 
+namespace o2::quality_control::core
+{
+class MonitorObject;
+} // namespace o2::quality_control::core
+
 namespace o2::quality_control::postprocessing
 {
 /// \brief  A extended version of the trending post-processing task.
@@ -61,6 +67,8 @@ class SliceTrendingTask : public PostProcessingInterface
   void initialize(Trigger, framework::ServiceRegistry&) final;
   void update(Trigger, framework::ServiceRegistry&) final;
   void finalize(Trigger, framework::ServiceRegistry&) final;
+  /// \brief Retrieves the objects of the data sources in advance, when running over many timestamps
+  void prefetch(Trigger, framework::ServiceRegistry&) final;
 
  private:
   struct MetaData {
@@ -68,6 +76,10 @@ class SliceTrendingTask : public PostProcessingInterface
   };
 
   /// \brief Methods specific to the trending itself.
+  /// \brief The objects of the data sources for one trigger, by data source name
+  using Inputs = std::unordered_map<std::string, std::shared_ptr<o2::quality_control::core::MonitorObject>>;
+
+  Inputs retrieveInputs(const Trigger& t, o2::quality_control::repository::DatabaseInterface&) const;
   void trendValues(const Trigger& t, o2::quality_control::repository::DatabaseInterface&);
   void generatePlots();
   void drawCanvasMO(TCanvas* thisCanvas, const std::string& var,
@@ -90,6 +102,7 @@ class SliceTrendingTask : public PostProcessingInterface
   std::unordered_map<std::string, std::vector<SliceInfo>*> mSources;
   std::unordered_map<std::string, int> mNumberPads;
   std::unordered_map<std::string, std::vector<std::vector<float>>> mAxisDivision;
+  PrefetchedInputs<Inputs> mPrefetchedInputs; //!
 };
 
 } // namespace o2::quality_control::postprocessing
@@ -31,6 +31,7 @@
 #include "QualityControl/Activity.h"
 #include "QualityControl/ObjectsManager.h"
 #include "QualityControl/QcInfoLogger.h"
+#include "QualityControl/TimingProbes.h"
 
 namespace o2::ccdb
 {
@@ -95,6 +96,11 @@ class TaskInterface
 
  protected:
   std::shared_ptr<ObjectsManager> getObjectsManager();
+  /// \brief Returns the timing probe with the given name, created at the first call.
+  /// Time a section of code with `ScopedTimingProbe probe(getTimingProbe("decoding"));`. The probes are published at
+  /// the end of each cycle as metrics, and as a MonitorObject if the custom parameter "publishTimingProbes" is "true".
+  /// The reference stays valid during the life of the task, it can be kept to avoid looking up the probe for each use.
+  TimingProbe& getTimingProbe(const std::string& name);
   //  TObject* retrieveCondition(std::string path, std::map<std::string, std::string> metadata = {}, long timestamp = -1);
   template <typename T>
   T* retrieveConditionAny(std::string const& path, std::map<std::string, std::string> const& metadata = {},
@@ -68,6 +68,9 @@ struct TaskSpec {
   std::string localControl = "aliecs";
   std::string mergingMode = "delta"; // todo as enum?
   int mergerCycleMultiplier = 1;
+  std::string mergersTopology = "single"; // "single" or "auto", todo as enum?
+  int monitorObjectsSize = 10;            // [MB], size of all the MOs of one task, used for the "auto" mergers topology
+  double mergerPerformance = 25.0;        // [objects/s] which can be merged by one Merger, used for the "auto" mergers topology
 };
 
 } // namespace o2::quality_control::core
@@ -0,0 +1,145 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   TimingProbes.h
+///
+
+#ifndef QC_CORE_TIMINGPROBES_H
+#define QC_CORE_TIMINGPROBES_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+class TH2F;
+
+namespace o2::monitoring
+{
+class Monitoring;
+}
+
+namespace o2::quality_control::core
+{
+
+/// \brief Accumulates the durations of a section of code.
+///
+/// The durations are kept in a histogram with 4 logarithmic bins per power of 2 of nanoseconds, from which the
+/// percentiles are estimated with a precision of about 20%. Adding a duration only updates a few atomic counters,
+/// thus a probe can be used by several threads at the same time without locking.
+class TimingProbe
+{
+ public:
+  struct Summary {
+    uint64_t count = 0;
+    double min = 0;  // all the durations are in microseconds
+    double mean = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double max = 0;
+  };
+
+  explicit TimingProbe(std::string name);
+
+  void add(uint64_t durationNs)
+  {
+    mBuckets[getBucket(durationNs)].fetch_add(1, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+    mSumNs.fetch_add(durationNs, std::memory_order_relaxed);
+    auto min = mMinNs.load(std::memory_order_relaxed);
+    while (durationNs < min && !mMinNs.compare_exchange_weak(min, durationNs, std::memory_order_relaxed)) {
+    }
+    auto max = mMaxNs.load(std::memory_order_relaxed);
+    while (durationNs > max && !mMaxNs.compare_exchange_weak(max, durationNs, std::memory_order_relaxed)) {
+    }
+  }
+
+  /// \brief Computes the statistics of the durations added since the last reset
+  Summary summarize() const;
+  void reset();
+  const std::string& getName() const { return mName; }
+
+  static constexpr size_t NBuckets = 252;
+  static size_t getBucket(uint64_t durationNs)
+  {
+    if (durationNs < 4) {
+      return durationNs;
+    }
+    int exponent = 63 - __builtin_clzll(durationNs);
+    return 4 * (exponent - 1) + ((durationNs >> (exponent - 2)) & 3);
+  }
+  static uint64_t getBucketLowEdge(size_t bucket);
+
+ private:
+  std::string mName;
+  std::array<std::atomic<uint64_t>, NBuckets> mBuckets;
+  std::atomic<uint64_t> mCount;
+  std::atomic<uint64_t> mSumNs;
+  std::atomic<uint64_t> mMinNs;
+  std::atomic<uint64_t> mMaxNs;
+};
+
+/// \brief Adds the time spent between its construction and its destruction to a TimingProbe
+class ScopedTimingProbe
+{
+ public:
+  explicit ScopedTimingProbe(TimingProbe& probe) : mProbe(probe), mStart(std::chrono::steady_clock::now()) {}
+  ~ScopedTimingProbe()
+  {
+    mProbe.add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart).count());
+  }
+  ScopedTimingProbe(const ScopedTimingProbe&) = delete;
+  ScopedTimingProbe& operator=(const ScopedTimingProbe&) = delete;
+
+ private:
+  TimingProbe& mProbe;
+  std::chrono::steady_clock::time_point mStart;
+};
+
+/// \brief The timing probes of a task, published at the end of each cycle.
+///
+/// Each probe is sent as the metric "qc_timing_<probe name>" with the count, min, mean, percentiles and max in
+/// microseconds. Optionally, a summary histogram with one column per probe can be published as a MonitorObject.
+class TimingProbes
+{
+ public:
+  TimingProbes();
+  ~TimingProbes();
+
+  /// \brief Returns the probe with the given name, it is created at the first call.
+  /// The reference stays valid as long as this object exists, it is worth keeping it instead of looking it up for each use.
+  TimingProbe& get(const std::string& name);
+
+  /// \brief Sends the statistics of the cycle to the monitoring, updates the summary histogram and resets the probes
+  void endOfCycle(o2::monitoring::Monitoring* monitoring);
+
+  /// \brief Returns the summary histogram, it is created at the first call
+  TH2F* getSummaryHistogram();
+
+  size_t size() const;
+
+ private:
+  void fillSummaryHistogram(const std::string& name, const TimingProbe::Summary& summary);
+
+  mutable std::mutex mMutex;
+  std::map<std::string, std::unique_ptr<TimingProbe>> mProbes;
+  std::unique_ptr<TH2F> mSummaryHistogram;
+};
+
+} // namespace o2::quality_control::core
+
+#endif // QC_CORE_TIMINGPROBES_H
@@ -20,6 +20,7 @@
 #include "QualityControl/PostProcessingInterface.h"
 #include "QualityControl/TrendingTaskConfig.h"
 #include "QualityControl/Reductor.h"
+#include "QualityControl/PrefetchedInputs.h"
 
 #include <memory>
 #include <unordered_map>
@@ -30,6 +31,12 @@ namespace o2::quality_control::repository
 class DatabaseInterface;
 }
 
+namespace o2::quality_control::core
+{
+class MonitorObject;
+class QualityObject;
+} // namespace o2::quality_control::core
+
 namespace o2::quality_control::postprocessing
 {
 
@@ -51,12 +58,20 @@ class TrendingTask : public PostProcessingInterface
   void initialize(Trigger, framework::ServiceRegistry&) override;
   void update(Trigger, framework::ServiceRegistry&) override;
   void finalize(Trigger, framework::ServiceRegistry&) override;
+  /// \brief Retrieves the objects of the data sources in advance, when running over many timestamps
+  void prefetch(Trigger, framework::ServiceRegistry&) override;
 
  private:
   struct MetaData {
     Int_t runNumber = 0;
   };
+  /// \brief The objects of the data sources for one trigger, by data source name
+  struct Inputs {
+    std::unordered_map<std::string, std::shared_ptr<core::MonitorObject>> monitorObjects;
+    std::unordered_map<std::string, std::shared_ptr<core::QualityObject>> qualityObjects;
+  };
 
+  Inputs retrieveInputs(const Trigger& t, repository::DatabaseInterface&) const;
   void trendValues(const Trigger& t, repository::DatabaseInterface&);
   void generatePlots();
 
@@ -66,6 +81,7 @@ class TrendingTask : public PostProcessingInterface
   std::unique_ptr<TTree> mTrend;
   std::map<std::string, TObject*> mPlots;
   std::unordered_map<std::string, std::unique_ptr<Reductor>> mReductors;
+  PrefetchedInputs<Inputs> mPrefetchedInputs; //!
 };
 
 } // namespace o2::quality_control::postprocessing
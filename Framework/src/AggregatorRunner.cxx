@@ -86,7 +86,8 @@ void AggregatorRunner::refreshConfig(InitContext& iCtx)
       }
 
       // read the config, prepare spec
-      auto infrastructureSpec = InfrastructureSpecReader::readInfrastructureSpec(updatedTree);
+      auto infrastructureSpec = InfrastructureSpecReader::readInfrastructureSpec(
+        updatedTree, InfrastructureSpecReader::CommonSection | InfrastructureSpecReader::AggregatorsSection);
 
       // replace the runner config
       mRunnerConfig = AggregatorRunnerFactory::extractRunnerConfig(infrastructureSpec.common);
@@ -125,6 +125,18 @@ std::tuple<size_t, double, double> cheapestMergers(double costCPU, double costRA
   return { bestR, lowestCPUCost, lowestRAMCost };
 }
 
+size_t cheapestReductionFactor(int parallelism, int mosSize, double cycleDuration, double mergerPerformance,
+                               double costCPU, double costRAM)
+{
+  if (parallelism < 2) {
+    // one merger is enough and it cannot be made any cheaper
+    return 1;
+  }
+  auto performance = [=](double /* Ri */) { return mergerPerformance; };
+  auto bestR = std::get<0>(cheapestMergers(costCPU, costRAM, parallelism, mosSize, cycleDuration, performance));
+  return bestR == (size_t)-1 ? 0 : bestR;
+}
+
 double qcTaskInputMemory(double utilisation, double avgInputMessage, double stddevInputMessage)
 {
   // we can use avgInputMessage and stddevInputMessage (which are in Bytes) instead of processing times,
@@ -26,6 +26,7 @@
 #include <CommonUtils/ConfigurableParam.h>
 
 #include <utility>
+#include <boost/property_tree/ptree.hpp>
 // QC
 #include "QualityControl/DatabaseFactory.h"
 #include "QualityControl/ServiceDiscovery.h"
@@ -180,8 +181,12 @@ void CheckRunner::refreshConfig(InitContext& iCtx)
         printTree(updatedTree);
       }
 
-      // prepare the information we need
-      auto infrastructureSpec = InfrastructureSpecReader::readInfrastructureSpec(updatedTree);
+      // prepare the information we need, only the checks of this runner are read
+      auto infrastructureSpec = InfrastructureSpecReader::readInfrastructureSpec(updatedTree, InfrastructureSpecReader::CommonSection);
+      infrastructureSpec.checks = InfrastructureSpecReader::readSectionSpec<CheckSpec>(
+        updatedTree, "checks", [this](const std::string& checkID, const boost::property_tree::ptree& checkTree) {
+          return mChecks.find(checkTree.get<std::string>("checkName", checkID)) != mChecks.end();
+        });
 
       // Use the config to reconfigure the check runner.
       // The configs for the checks we find in the config and in our map are updated.
@@ -31,6 +31,7 @@
 #include "QualityControl/InfrastructureSpec.h"
 #include "QualityControl/RootFileSink.h"
 #include "QualityControl/RootFileSource.h"
+#include "QualityControl/Calculators.h"
 
 #include <Configuration/ConfigurationFactory.h>
 #include <Framework/DataSpecUtils.h>
@@ -208,7 +209,9 @@ o2::framework::WorkflowSpec InfrastructureGenerator::generateRemoteInfrastructur
       size_t resetAfterCycles = taskSpec.mergingMode == "delta" ? taskSpec.resetAfterCycles : 0;
       auto cycleDurationSeconds = taskSpec.cycleDurationSeconds * taskSpec.mergerCycleMultiplier;
 
-      generateMergers(workflow, taskSpec.taskName, numberOfLocalMachines, cycleDurationSeconds, taskSpec.mergingMode, resetAfterCycles, infrastructureSpec.common.monitoringUrl, taskSpec.detectorName);
+      size_t reductionFactor = computeMergersReductionFactor(taskSpec, numberOfLocalMachines, cycleDurationSeconds);
+
+      generateMergers(workflow, taskSpec.taskName, numberOfLocalMachines, reductionFactor, cycleDurationSeconds, taskSpec.mergingMode, resetAfterCycles, infrastructureSpec.common.monitoringUrl, taskSpec.detectorName);
 
     } else if (taskSpec.location == TaskLocationSpec::Remote) {
 
@@ -482,7 +485,7 @@ void InfrastructureGenerator::generateLocalTaskRemoteProxy(framework::WorkflowSp
 }
 
 void InfrastructureGenerator::generateMergers(framework::WorkflowSpec& workflow, std::string taskName,
-                                              size_t numberOfLocalMachines, double cycleDurationSeconds,
+                                              size_t numberOfLocalMachines, size_t reductionFactor, double cycleDurationSeconds,
                                               std::string mergingMode, size_t resetAfterCycles, std::string monitoringUrl,
                                               std::string detectorName)
 {
@@ -506,8 +509,11 @@ void InfrastructureGenerator::generateMergers(framework::WorkflowSpec& workflow,
   mergerConfig.inputObjectTimespan = { (mergingMode.empty() || mergingMode == "delta") ? InputObjectsTimespan::LastDifference : InputObjectsTimespan::FullHistory };
   mergerConfig.publicationDecision = { PublicationDecision::EachNSeconds, cycleDurationSeconds };
   mergerConfig.mergedObjectTimespan = { MergedObjectTimespan::NCycles, (int)resetAfterCycles };
-  // for now one merger should be enough, multiple layers to be supported later
-  mergerConfig.topologySize = { TopologySize::NumberOfLayers, 1 };
+  if (reductionFactor > 1 && reductionFactor < numberOfLocalMachines) {
+    mergerConfig.topologySize = { TopologySize::ReductionFactor, (int)reductionFactor };
+  } else {
+    mergerConfig.topologySize = { TopologySize::NumberOfLayers, 1 };
+  }
   mergerConfig.monitoringUrl = monitoringUrl;
   mergerConfig.detectorName = detectorName;
   mergersBuilder.setConfig(mergerConfig);
@@ -515,6 +521,30 @@ void InfrastructureGenerator::generateMergers(framework::WorkflowSpec& workflow,
   mergersBuilder.generateInfrastructure(workflow);
 }
 
+size_t InfrastructureGenerator::computeMergersReductionFactor(const TaskSpec& taskSpec, size_t numberOfLocalMachines, double cycleDurationSeconds)
+{
+  if (taskSpec.mergersTopology != "auto" || numberOfLocalMachines < 2) {
+    if (taskSpec.mergersTopology != "single" && taskSpec.mergersTopology != "auto") {
+      ILOG(Warning, Support) << "Unknown mergersTopology '" << taskSpec.mergersTopology << "' for the task " << taskSpec.taskName
+                             << ", one layer of Mergers will be used" << ENDM;
+    }
+    return numberOfLocalMachines;
+  }
+
+  // We rely on the size of the objects declared in the config, since the actual one is known only once the tasks run.
+  size_t reductionFactor = calculators::cheapestReductionFactor(numberOfLocalMachines, taskSpec.monitorObjectsSize,
+                                                                cycleDurationSeconds, taskSpec.mergerPerformance);
+  if (reductionFactor == 0) {
+    ILOG(Warning, Support) << "None of the Mergers topologies for the task " << taskSpec.taskName << " can merge "
+                           << numberOfLocalMachines << " inputs every " << cycleDurationSeconds
+                           << " s, the one with the most Mergers will be used" << ENDM;
+    reductionFactor = 2;
+  }
+  ILOG(Info, Devel) << "Mergers of the task " << taskSpec.taskName << ": reduction factor " << reductionFactor << ", "
+                    << calculators::numberOfMergerLayers(numberOfLocalMachines, reductionFactor) << " layer(s)" << ENDM;
+  return reductionFactor;
+}
+
 void InfrastructureGenerator::generateCheckRunners(framework::WorkflowSpec& workflow, const InfrastructureSpec& infrastructureSpec)
 {
   // todo have a look if this complex procedure can be simplified.
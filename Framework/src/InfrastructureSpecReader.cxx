@@ -33,20 +33,37 @@ namespace o2::quality_control::core
 {
 
 InfrastructureSpec InfrastructureSpecReader::readInfrastructureSpec(const boost::property_tree::ptree& wholeTree)
+{
+  return readInfrastructureSpec(wholeTree, AllSections);
+}
+
+InfrastructureSpec InfrastructureSpecReader::readInfrastructureSpec(const boost::property_tree::ptree& wholeTree, uint8_t sections)
 {
   InfrastructureSpec spec;
   const auto& qcTree = wholeTree.get_child("qc");
-  if (qcTree.find("config") != qcTree.not_found()) {
-    spec.common = readSpecEntry<CommonSpec>("", qcTree.get_child("config"), wholeTree);
-  } else {
-    ILOG(Error) << "The \"config\" section in the provided QC config file is missing." << ENDM;
+  if (sections & CommonSection) {
+    if (qcTree.find("config") != qcTree.not_found()) {
+      spec.common = readSpecEntry<CommonSpec>("", qcTree.get_child("config"), wholeTree);
+    } else {
+      ILOG(Error) << "The \"config\" section in the provided QC config file is missing." << ENDM;
+    }
   }
 
-  spec.tasks = readSectionSpec<TaskSpec>(wholeTree, "tasks");
-  spec.checks = readSectionSpec<CheckSpec>(wholeTree, "checks");
-  spec.aggregators = readSectionSpec<AggregatorSpec>(wholeTree, "aggregators");
-  spec.postProcessingTasks = readSectionSpec<PostProcessingTaskSpec>(wholeTree, "postprocessing");
-  spec.externalTasks = readSectionSpec<ExternalTaskSpec>(wholeTree, "externalTasks");
+  if (sections & TasksSection) {
+    spec.tasks = readSectionSpec<TaskSpec>(wholeTree, "tasks");
+  }
+  if (sections & ChecksSection) {
+    spec.checks = readSectionSpec<CheckSpec>(wholeTree, "checks");
+  }
+  if (sections & AggregatorsSection) {
+    spec.aggregators = readSectionSpec<AggregatorSpec>(wholeTree, "aggregators");
+  }
+  if (sections & PostProcessingSection) {
+    spec.postProcessingTasks = readSectionSpec<PostProcessingTaskSpec>(wholeTree, "postprocessing");
+  }
+  if (sections & ExternalTasksSection) {
+    spec.externalTasks = readSectionSpec<ExternalTaskSpec>(wholeTree, "externalTasks");
+  }
 
   return spec;
 }
@@ -128,6 +145,9 @@ TaskSpec InfrastructureSpecReader::readSpecEntry<TaskSpec>(std::string taskID, c
   ts.localControl = taskTree.get<std::string>("localControl", ts.localControl);
   ts.mergingMode = taskTree.get<std::string>("mergingMode", ts.mergingMode);
   ts.mergerCycleMultiplier = taskTree.get<int>("mergerCycleMultiplier", ts.mergerCycleMultiplier);
+  ts.mergersTopology = taskTree.get<std::string>("mergersTopology", ts.mergersTopology);
+  ts.monitorObjectsSize = taskTree.get<int>("monitorObjectsSize", ts.monitorObjectsSize);
+  ts.mergerPerformance = taskTree.get<double>("mergerPerformance", ts.mergerPerformance);
 
   return ts;
 }
@@ -18,6 +18,7 @@
 
 #include "QualityControl/QcInfoLogger.h"
 #include "QualityControl/ServiceDiscovery.h"
+#include "QualityControl/TimingProbes.h"
 #include "QualityControl/MonitorObjectCollection.h"
 #include <Common/Exceptions.h>
 #include <TObjArray.h>
@@ -33,7 +34,7 @@ const std::string ObjectsManager::gDrawOptionsKey = "drawOptions";
 const std::string ObjectsManager::gDisplayHintsKey = "displayHints";
 
 ObjectsManager::ObjectsManager(std::string taskName, std::string taskClass, std::string detectorName, std::string consulUrl, int parallelTaskID, bool noDiscovery)
-  : mTaskName(taskName), mTaskClass(taskClass), mDetectorName(detectorName), mUpdateServiceDiscovery(false)
+  : mTaskName(taskName), mTaskClass(taskClass), mDetectorName(detectorName), mUpdateServiceDiscovery(false), mTimingProbes(std::make_unique<TimingProbes>())
 {
   mMonitorObjects = std::make_unique<MonitorObjectCollection>();
   mMonitorObjects->SetOwner(true);
@@ -193,4 +194,9 @@ void ObjectsManager::setActivity(const Activity& activity)
   }
 }
 
+TimingProbes& ObjectsManager::getTimingProbes()
+{
+  return *mTimingProbes;
+}
+
 } // namespace o2::quality_control::core
@@ -31,6 +31,15 @@ void PostProcessingInterface::configure(std::string name, const boost::property_
   mName = name;
 }
 
+void PostProcessingInterface::prefetch(Trigger, framework::ServiceRegistry&)
+{
+}
+
+bool PostProcessingInterface::isOrderIndependent() const
+{
+  return false;
+}
+
 void PostProcessingInterface::setObjectsManager(std::shared_ptr<core::ObjectsManager> objectsManager)
 {
   mObjectsManager = objectsManager;
@@ -25,8 +25,11 @@
 
 #include <boost/property_tree/ptree.hpp>
 #include <utility>
+#include <deque>
+#include <future>
 #include <Framework/DataAllocator.h>
 #include <CommonUtils/ConfigurableParam.h>
+#include <TROOT.h>
 
 using namespace o2::quality_control::core;
 using namespace o2::quality_control::repository;
@@ -48,7 +51,12 @@ void PostProcessingRunner::setPublicationCallback(MOCPublicationCallback callbac
 
 void PostProcessingRunner::init(const boost::property_tree::ptree& config)
 {
-  auto specs = InfrastructureSpecReader::readInfrastructureSpec(config);
+  auto specs = InfrastructureSpecReader::readInfrastructureSpec(config, InfrastructureSpecReader::CommonSection);
+  // each post-processing task spec holds a copy of the whole tree, thus we read only ours
+  specs.postProcessingTasks = InfrastructureSpecReader::readSectionSpec<PostProcessingTaskSpec>(
+    config, "postprocessing", [name = mName](const std::string& ppTaskID, const boost::property_tree::ptree&) {
+      return ppTaskID == name;
+    });
   auto ppTaskSpec = std::find_if(specs.postProcessingTasks.begin(),
                                  specs.postProcessingTasks.end(),
                                  [name = mName](const auto& spec) {
@@ -134,7 +142,7 @@ bool PostProcessingRunner::run()
   return true;
 }
 
-void PostProcessingRunner::runOverTimestamps(const std::vector<uint64_t>& timestamps)
+void PostProcessingRunner::runOverTimestamps(const std::vector<uint64_t>& timestamps, size_t parallelism)
 {
   if (timestamps.size() < 2) {
     throw std::runtime_error(
@@ -144,6 +152,19 @@ void PostProcessingRunner::runOverTimestamps(const std::vector<uint64_t>& timest
 
   ILOG(Info, Support) << "Running the task '" << mTask->getName() << "' over " << timestamps.size() << " timestamps." << ENDM;
 
+  if (parallelism > 1 && timestamps.size() > 2) {
+    // the objects are retrieved and processed with ROOT on several threads
+    ROOT::EnableThreadSafety();
+    if (mTask->isOrderIndependent()) {
+      ILOG(Info, Support) << "The task is order-independent, running up to " << parallelism << " updates in parallel." << ENDM;
+      runOverTimestampsInParallel(timestamps, parallelism);
+    } else {
+      ILOG(Info, Support) << "Prefetching the inputs of up to " << parallelism << " updates in advance." << ENDM;
+      runOverTimestampsPipelined(timestamps, parallelism);
+    }
+    return;
+  }
+
   doInitialize({ TriggerType::UserOrControl, false, mTaskConfig.activity, timestamps.front() });
   for (size_t i = 1; i < timestamps.size() - 1; i++) {
     doUpdate({ TriggerType::UserOrControl, i == timestamps.size() - 2, mTaskConfig.activity, timestamps[i] });
@@ -151,6 +172,105 @@ void PostProcessingRunner::runOverTimestamps(const std::vector<uint64_t>& timest
   doFinalize({ TriggerType::UserOrControl, false, mTaskConfig.activity, timestamps.back() });
 }
 
+void PostProcessingRunner::runOverTimestampsPipelined(const std::vector<uint64_t>& timestamps, size_t depth)
+{
+  const size_t lastUpdate = timestamps.size() - 2;
+  auto updateTrigger = [&](size_t i) -> Trigger {
+    return { TriggerType::UserOrControl, i == lastUpdate, mTaskConfig.activity, timestamps[i] };
+  };
+
+  doInitialize({ TriggerType::UserOrControl, false, mTaskConfig.activity, timestamps.front() });
+
+  // We keep up to 'depth' prefetches in flight, the oldest of them always belonging to the current update.
+  std::deque<std::future<void>> prefetches;
+  size_t nextPrefetch = 1;
+  for (size_t i = 1; i <= lastUpdate; i++) {
+    for (; nextPrefetch <= lastUpdate && nextPrefetch < i + depth; nextPrefetch++) {
+      prefetches.push_back(std::async(std::launch::async, [this, trigger = updateTrigger(nextPrefetch)]() {
+        mTask->prefetch(trigger, mServices);
+      }));
+    }
+    prefetches.front().get();
+    prefetches.pop_front();
+    doUpdate(updateTrigger(i));
+  }
+
+  doFinalize({ TriggerType::UserOrControl, false, mTaskConfig.activity, timestamps.back() });
+}
+
+void PostProcessingRunner::runOverTimestampsInParallel(const std::vector<uint64_t>& timestamps, size_t parallelism)
+{
+  const size_t lastUpdate = timestamps.size() - 2;
+  parallelism = std::min(parallelism, lastUpdate);
+  auto updateTrigger = [&](size_t i) -> Trigger {
+    return { TriggerType::UserOrControl, i == lastUpdate, mTaskConfig.activity, timestamps[i] };
+  };
+  Trigger initTrigger{ TriggerType::UserOrControl, false, mTaskConfig.activity, timestamps.front() };
+  Trigger stopTrigger{ TriggerType::UserOrControl, false, mTaskConfig.activity, timestamps.back() };
+
+  doInitialize(initTrigger);
+  std::vector<std::unique_ptr<TaskReplica>> replicas;
+  for (size_t r = 1; r < parallelism; r++) {
+    auto replica = createReplica();
+    replica->task->initialize(initTrigger, replica->services);
+    replicas.push_back(std::move(replica));
+  }
+
+  struct Instance {
+    PostProcessingInterface* task;
+    ObjectsManager* objectsManager;
+    framework::ServiceRegistry* services;
+  };
+  std::vector<Instance> instances{ { mTask.get(), mObjectManager.get(), &mServices } };
+  for (auto& replica : replicas) {
+    instances.push_back({ replica->task.get(), replica->objectsManager.get(), &replica->services });
+  }
+  // The last update always goes to the main instance, so it is finalized in the same state as in the sequential mode.
+  // Any 'parallelism' consecutive updates are assigned to different instances.
+  auto instanceOf = [&](size_t i) -> Instance& { return instances[(lastUpdate - i) % parallelism]; };
+
+  for (size_t first = 1; first <= lastUpdate; first += parallelism) {
+    const size_t last = std::min(first + parallelism - 1, lastUpdate);
+    std::vector<std::future<void>> updates;
+    for (size_t i = first; i <= last; i++) {
+      updates.push_back(std::async(std::launch::async, [instance = instanceOf(i), trigger = updateTrigger(i)]() {
+        instance.task->prefetch(trigger, *instance.services);
+        instance.task->update(trigger, *instance.services);
+      }));
+    }
+    for (size_t i = first; i <= last; i++) {
+      updates[i - first].get();
+      ILOG(Info, Support) << "Updated the user task due to trigger '" << updateTrigger(i) << "'" << ENDM;
+      publish(*instanceOf(i).objectsManager, timestamps[i]);
+    }
+  }
+
+  // Only the main instance publishes its objects at finalization, the replicas are just given a chance to clean up.
+  for (auto& replica : replicas) {
+    replica->task->finalize(stopTrigger, replica->services);
+  }
+  doFinalize(stopTrigger);
+}
+
+std::unique_ptr<PostProcessingRunner::TaskReplica> PostProcessingRunner::createReplica()
+{
+  auto replica = std::make_unique<TaskReplica>();
+  replica->database = DatabaseFactory::create(mRunnerConfig.database.at("implementation"));
+  replica->database->connect(mRunnerConfig.database);
+  replica->services.registerService<DatabaseInterface>(replica->database.get());
+  replica->objectsManager = std::make_shared<ObjectsManager>(mTaskConfig.taskName, mTaskConfig.className, mTaskConfig.detectorName, mRunnerConfig.consulUrl, 0, true);
+
+  PostProcessingFactory f;
+  replica->task.reset(f.create(mTaskConfig));
+  if (!replica->task) {
+    throw std::runtime_error("Failed to create a replica of the task '" + mTaskConfig.taskName + "'");
+  }
+  replica->task->setObjectsManager(replica->objectsManager);
+  replica->task->setName(mTaskConfig.taskName);
+  replica->task->configure(mTaskConfig.taskName, mRunnerConfig.configTree);
+  return replica;
+}
+
 void PostProcessingRunner::start(const framework::ServiceRegistry* dplServices)
 {
   if (dplServices != nullptr) {
@@ -220,16 +340,22 @@ void PostProcessingRunner::doUpdate(Trigger trigger)
 {
   ILOG(Info, Support) << "Updating the user task due to trigger '" << trigger << "'" << ENDM;
   mTask->update(trigger, mServices);
-  mPublicationCallback(mObjectManager->getNonOwningArray(), trigger.timestamp, trigger.timestamp + objectValidity);
+  publish(*mObjectManager, trigger.timestamp);
 }
 
 void PostProcessingRunner::doFinalize(Trigger trigger)
 {
   ILOG(Info, Support) << "Finalizing the user task due to trigger '" << trigger << "'" << ENDM;
   mTask->finalize(trigger, mServices);
-  mPublicationCallback(mObjectManager->getNonOwningArray(), trigger.timestamp, trigger.timestamp + objectValidity);
+  publish(*mObjectManager, trigger.timestamp);
   mTaskState = TaskState::Finished;
 }
+
+void PostProcessingRunner::publish(ObjectsManager& objectsManager, uint64_t timestamp)
+{
+  mPublicationCallback(objectsManager.getNonOwningArray(), timestamp, timestamp + objectValidity);
+}
+
 const std::string& PostProcessingRunner::getName()
 {
   return mName;
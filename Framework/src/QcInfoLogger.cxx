@@ -23,6 +23,8 @@ namespace o2::quality_control::core
 AliceO2::InfoLogger::InfoLogger* QcInfoLogger::instance;
 AliceO2::InfoLogger::InfoLoggerContext* QcInfoLogger::mContext;
 QcInfoLogger::_init QcInfoLogger::_initializer;
+std::atomic<bool> QcInfoLogger::mDiscardDebug{ false };
+std::atomic<int> QcInfoLogger::mDiscardFromLevel{ INT_MAX };
 
 void QcInfoLogger::setFacility(const std::string& facility)
 {
@@ -77,7 +79,13 @@ void QcInfoLogger::init(const std::string& facility,
   // Set the proper discard filters
   ILOG_INST.filterDiscardDebug(discardDebug);
   ILOG_INST.filterDiscardLevel(discardFromLevel);
-  if (!discardToFile.empty()) {
+  if (discardToFile.empty()) {
+    mDiscardDebug.store(discardDebug, std::memory_order_relaxed);
+    mDiscardFromLevel.store(discardFromLevel, std::memory_order_relaxed);
+  } else {
+    // the discarded messages must reach the InfoLogger to be written to the file, thus we do not skip them
+    mDiscardDebug.store(false, std::memory_order_relaxed);
+    mDiscardFromLevel.store(INT_MAX, std::memory_order_relaxed);
     ILOG_INST.filterDiscardSetFile(discardToFile.c_str(), 1000000000, 10);
   }
   ILOG(Debug, Ops) << "QC infologger initialized" << ENDM;
@@ -108,8 +108,15 @@ void SliceTrendingTask::update(Trigger t, framework::ServiceRegistry& services)
   }
 }
 
+void SliceTrendingTask::prefetch(Trigger t, framework::ServiceRegistry& services)
+{
+  auto& qcdb = services.get<repository::DatabaseInterface>();
+  mPrefetchedInputs.put(t.timestamp, retrieveInputs(t, qcdb));
+}
+
 void SliceTrendingTask::finalize(Trigger t, framework::ServiceRegistry&)
 {
+  mPrefetchedInputs.clear();
   if (!mConfig.producePlotsOnUpdate) {
     getObjectsManager()->startPublishing(mTrend.get());
   }
@@ -121,17 +128,31 @@ void SliceTrendingTask::finalize(Trigger t, framework::ServiceRegistry&)
   }
 }
 
+SliceTrendingTask::Inputs SliceTrendingTask::retrieveInputs(const Trigger& t, repository::DatabaseInterface& qcdb) const
+{
+  Inputs inputs;
+  for (const auto& dataSource : mConfig.dataSources) {
+    if (dataSource.type == "repository") {
+      inputs[dataSource.name] = qcdb.retrieveMO(dataSource.path, dataSource.name, t.timestamp, t.activity);
+    }
+  }
+  return inputs;
+}
+
 void SliceTrendingTask::trendValues(const Trigger& t,
                                     repository::DatabaseInterface& qcdb)
 {
   mTime = t.timestamp / 1000; // ROOT expects seconds since epoch.
   mMetaData.runNumber = -1;
 
+  auto prefetched = mPrefetchedInputs.take(t.timestamp);
+  Inputs inputs = prefetched ? std::move(*prefetched) : retrieveInputs(t, qcdb);
+
   for (auto& dataSource : mConfig.dataSources) {
     mNumberPads[dataSource.name] = 0;
     mSources[dataSource.name]->clear();
     if (dataSource.type == "repository") {
-      auto mo = qcdb.retrieveMO(dataSource.path, dataSource.name, t.timestamp, t.activity);
+      auto& mo = inputs[dataSource.name];
       TObject* obj = mo ? mo->getObject() : nullptr;
 
       mAxisDivision[dataSource.name] = dataSource.axisDivision;
@@ -56,6 +56,11 @@ void TaskInterface::setCustomParameters(const std::unordered_map<std::string, st
 
 std::shared_ptr<ObjectsManager> TaskInterface::getObjectsManager() { return mObjectsManager; }
 
+TimingProbe& TaskInterface::getTimingProbe(const std::string& name)
+{
+  return mObjectsManager->getTimingProbes().get(name);
+}
+
 void TaskInterface::setMonitoring(const std::shared_ptr<o2::monitoring::Monitoring>& mMonitoring)
 {
   TaskInterface::mMonitoring = mMonitoring;
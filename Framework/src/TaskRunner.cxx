@@ -39,6 +39,7 @@
 #include "QualityControl/InfrastructureSpecReader.h"
 #include "QualityControl/TaskRunnerFactory.h"
 #include "QualityControl/ConfigParamGlo.h"
+#include "QualityControl/TimingProbes.h"
 
 #include <string>
 #include <TFile.h>
@@ -80,8 +81,12 @@ void TaskRunner::refreshConfig(InitContext& iCtx)
         printTree(updatedTree);
       }
 
-      // prepare the information we need
-      auto infrastructureSpec = InfrastructureSpecReader::readInfrastructureSpec(updatedTree);
+      // prepare the information we need, only our task is read
+      auto infrastructureSpec = InfrastructureSpecReader::readInfrastructureSpec(updatedTree, InfrastructureSpecReader::CommonSection);
+      infrastructureSpec.tasks = InfrastructureSpecReader::readSectionSpec<TaskSpec>(
+        updatedTree, "tasks", [this](const std::string& taskID, const boost::property_tree::ptree& taskTree) {
+          return taskTree.get<std::string>("taskName", taskID) == mTaskConfig.taskName;
+        });
       // find the correct taskSpec
       auto taskSpecIter = find_if(infrastructureSpec.tasks.begin(),
                                   infrastructureSpec.tasks.end(),
@@ -163,6 +168,12 @@ void TaskRunner::init(InitContext& iCtx)
   mTask->setCcdbUrl(mTaskConfig.conditionUrl);
   mTask->initialize(iCtx);
 
+  // publish the summary of the timing probes of the task if requested
+  auto publishTimingProbes = mTaskConfig.customParameters.find("publishTimingProbes");
+  if (publishTimingProbes != mTaskConfig.customParameters.end() && publishTimingProbes->second == "true") {
+    mObjectsManager->startPublishing(mObjectsManager->getTimingProbes().getSummaryHistogram());
+  }
+
   mNoMoreCycles = false;
   mCycleNumber = 0;
 }
@@ -430,6 +441,7 @@ void TaskRunner::finishCycle(DataAllocator& outputs)
 {
   ILOG(Debug, Ops) << "Finish cycle " << mCycleNumber << ENDM;
   mTask->endOfCycle();
+  mObjectsManager->getTimingProbes().endOfCycle(mCollector.get());
 
   mNumberObjectsPublishedInCycle += publish(outputs);
   mTotalNumberObjectsPublished += mNumberObjectsPublishedInCycle;
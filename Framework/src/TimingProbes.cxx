@@ -0,0 +1,158 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   TimingProbes.cxx
+///
+
+#include "QualityControl/TimingProbes.h"
+
+#include <Monitoring/Monitoring.h>
+#include <TH2F.h>
+#include <algorithm>
+#include <limits>
+
+using namespace o2::monitoring;
+
+namespace o2::quality_control::core
+{
+
+TimingProbe::TimingProbe(std::string name) : mName(std::move(name))
+{
+  reset();
+}
+
+uint64_t TimingProbe::getBucketLowEdge(size_t bucket)
+{
+  if (bucket < 4) {
+    return bucket;
+  }
+  int exponent = bucket / 4 + 1;
+  return (4 + bucket % 4) << (exponent - 2);
+}
+
+TimingProbe::Summary TimingProbe::summarize() const
+{
+  Summary summary;
+  summary.count = mCount.load(std::memory_order_relaxed);
+  if (summary.count == 0) {
+    return summary;
+  }
+  const double nsToUs = 1e-3;
+  const auto minNs = mMinNs.load(std::memory_order_relaxed);
+  const auto maxNs = mMaxNs.load(std::memory_order_relaxed);
+  summary.min = minNs * nsToUs;
+  summary.max = maxNs * nsToUs;
+  summary.mean = static_cast<double>(mSumNs.load(std::memory_order_relaxed)) / summary.count * nsToUs;
+
+  // the percentiles are estimated with the middle of the bucket where they fall, within the observed range
+  std::array<double*, 3> percentiles{ &summary.p50, &summary.p90, &summary.p99 };
+  std::array<double, 3> fractions{ 0.5, 0.9, 0.99 };
+  uint64_t cumulated = 0;
+  size_t iPercentile = 0;
+  for (size_t bucket = 0; bucket < NBuckets && iPercentile < percentiles.size(); bucket++) {
+    cumulated += mBuckets[bucket].load(std::memory_order_relaxed);
+    while (iPercentile < percentiles.size() && cumulated >= fractions[iPercentile] * summary.count) {
+      double low = getBucketLowEdge(bucket);
+      double high = bucket + 1 < NBuckets ? getBucketLowEdge(bucket + 1) : low;
+      double estimate = std::clamp((low + high) / 2, static_cast<double>(minNs), static_cast<double>(maxNs));
+      *percentiles[iPercentile] = estimate * nsToUs;
+      iPercentile++;
+    }
+  }
+  return summary;
+}
+
+void TimingProbe::reset()
+{
+  for (auto& bucket : mBuckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  mCount.store(0, std::memory_order_relaxed);
+  mSumNs.store(0, std::memory_order_relaxed);
+  mMinNs.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  mMaxNs.store(0, std::memory_order_relaxed);
+}
+
+TimingProbes::TimingProbes() = default;
+
+TimingProbes::~TimingProbes() = default;
+
+TimingProbe& TimingProbes::get(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto& probe = mProbes[name];
+  if (!probe) {
+    probe = std::make_unique<TimingProbe>(name);
+  }
+  return *probe;
+}
+
+size_t TimingProbes::size() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mProbes.size();
+}
+
+void TimingProbes::endOfCycle(Monitoring* monitoring)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mSummaryHistogram) {
+    mSummaryHistogram->Reset();
+  }
+  for (auto& [name, probe] : mProbes) {
+    auto summary = probe->summarize();
+    probe->reset();
+    if (monitoring) {
+      monitoring->send(Metric{ "qc_timing_" + name }
+                         .addValue(summary.count, "count")
+                         .addValue(summary.min, "min_us")
+                         .addValue(summary.mean, "mean_us")
+                         .addValue(summary.p50, "p50_us")
+                         .addValue(summary.p90, "p90_us")
+                         .addValue(summary.p99, "p99_us")
+                         .addValue(summary.max, "max_us"));
+    }
+    if (mSummaryHistogram) {
+      fillSummaryHistogram(name, summary);
+    }
+  }
+}
+
+TH2F* TimingProbes::getSummaryHistogram()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (!mSummaryHistogram) {
+    mSummaryHistogram = std::make_unique<TH2F>("TimingProbes", "Timing probes in the last cycle;;duration (#mus)", 1, 0, 1, 6, 0, 6);
+    mSummaryHistogram->SetDirectory(nullptr);
+    mSummaryHistogram->SetCanExtend(TH1::kXaxis);
+    int bin = 1;
+    for (const auto* label : { "min", "mean", "p50", "p90", "p99", "max" }) {
+      mSummaryHistogram->GetYaxis()->SetBinLabel(bin++, label);
+    }
+  }
+  return mSummaryHistogram.get();
+}
+
+void TimingProbes::fillSummaryHistogram(const std::string& name, const TimingProbe::Summary& summary)
+{
+  const std::array<std::pair<const char*, double>, 6> values{ { { "min", summary.min },
+                                                                { "mean", summary.mean },
+                                                                { "p50", summary.p50 },
+                                                                { "p90", summary.p90 },
+                                                                { "p99", summary.p99 },
+                                                                { "max", summary.max } } };
+  for (const auto& [label, value] : values) {
+    mSummaryHistogram->Fill(name.c_str(), label, value);
+  }
+}
+
+} // namespace o2::quality_control::core
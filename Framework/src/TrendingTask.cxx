@@ -18,6 +18,7 @@
 #include "QualityControl/QcInfoLogger.h"
 #include "QualityControl/DatabaseInterface.h"
 #include "QualityControl/MonitorObject.h"
+#include "QualityControl/QualityObject.h"
 #include "QualityControl/Reductor.h"
 #include "QualityControl/RootClassFactory.h"
 #include <boost/property_tree/ptree.hpp>
@@ -66,14 +67,34 @@ void TrendingTask::update(Trigger t, framework::ServiceRegistry& services)
   }
 }
 
+void TrendingTask::prefetch(Trigger t, framework::ServiceRegistry& services)
+{
+  auto& qcdb = services.get<repository::DatabaseInterface>();
+  mPrefetchedInputs.put(t.timestamp, retrieveInputs(t, qcdb));
+}
+
 void TrendingTask::finalize(Trigger, framework::ServiceRegistry&)
 {
+  mPrefetchedInputs.clear();
   if (!mConfig.producePlotsOnUpdate) {
     getObjectsManager()->startPublishing(mTrend.get());
   }
   generatePlots();
 }
 
+TrendingTask::Inputs TrendingTask::retrieveInputs(const Trigger& t, repository::DatabaseInterface& qcdb) const
+{
+  Inputs inputs;
+  for (const auto& dataSource : mConfig.dataSources) {
+    if (dataSource.type == "repository") {
+      inputs.monitorObjects[dataSource.name] = qcdb.retrieveMO(dataSource.path, dataSource.name, t.timestamp, t.activity);
+    } else if (dataSource.type == "repository-quality") {
+      inputs.qualityObjects[dataSource.name] = qcdb.retrieveQO(dataSource.path + "/" + dataSource.name, t.timestamp, t.activity);
+    }
+  }
+  return inputs;
+}
+
 void TrendingTask::trendValues(const Trigger& t, repository::DatabaseInterface& qcdb)
 {
   mTime = t.timestamp / 1000; // ROOT expects seconds since epoch
@@ -81,17 +102,20 @@ void TrendingTask::trendValues(const Trigger& t, repository::DatabaseInterface&
   //  enough if we trend across runs).
   mMetaData.runNumber = -1;
 
+  auto prefetched = mPrefetchedInputs.take(t.timestamp);
+  Inputs inputs = prefetched ? std::move(*prefetched) : retrieveInputs(t, qcdb);
+
   for (auto& dataSource : mConfig.dataSources) {
 
     // todo: make it agnostic to MOs, QOs or other objects. Let the reductor cast to whatever it needs.
     if (dataSource.type == "repository") {
-      auto mo = qcdb.retrieveMO(dataSource.path, dataSource.name, t.timestamp, t.activity);
+      auto& mo = inputs.monitorObjects[dataSource.name];
       TObject* obj = mo ? mo->getObject() : nullptr;
       if (obj) {
         mReductors[dataSource.name]->update(obj);
       }
     } else if (dataSource.type == "repository-quality") {
-      auto qo = qcdb.retrieveQO(dataSource.path + "/" + dataSource.name, t.timestamp, t.activity);
+      auto& qo = inputs.qualityObjects[dataSource.name];
       if (qo) {
         mReductors[dataSource.name]->update(qo.get());
       }
@@ -84,14 +84,12 @@ using namespace o2::configuration;
 
 WorkflowSpec defineDataProcessing(ConfigContext const& config)
 {
-  QcInfoLogger::setFacility("runAdvanced");
-
   bool noQC = config.options().get<bool>("no-qc");
   bool noDebug = config.options().get<bool>("no-debug-output");
+  QcInfoLogger::init("runAdvanced", noDebug);
   const std::string qcConfigurationSource =
     std::string("json://") + getenv("QUALITYCONTROL_ROOT") + "/etc/advanced.json";
   ILOG(Info, Support) << "Using config file '" << qcConfigurationSource << "'";
-  ILOG_INST.filterDiscardDebug(noDebug);
 
   // Full processing topology.
   // We pretend to spawn topologies on three processing machines
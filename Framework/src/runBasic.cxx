@@ -94,10 +94,8 @@ WorkflowSpec defineDataProcessing(const ConfigContext& config)
   auto infologgerFilterDiscardDebug = configTree.get<bool>("qc.config.infologger.filterDiscardDebug", false);
   auto infologgerDiscardLevel = configTree.get<int>("qc.config.infologger.filterDiscardLevel", 21);
   auto infologgerDiscardFile = configTree.get<std::string>("qc.config.infologger.filterDiscardFile", "");
-  ILOG_INST.filterDiscardDebug(infologgerFilterDiscardDebug);
-  ILOG_INST.filterDiscardLevel(infologgerDiscardLevel);
-  ILOG_INST.filterDiscardSetFile(infologgerDiscardFile.c_str());
-  QcInfoLogger::setFacility("runBasic");
+  // through QcInfoLogger, so that the messages discarded by these filters are not even formatted
+  QcInfoLogger::init("runBasic", infologgerFilterDiscardDebug, infologgerDiscardLevel, infologgerDiscardFile);
 
   // The producer to generate some data in the workflow
   DataProcessorSpec producer = getDataProducerSpec(1, 10000, 10);
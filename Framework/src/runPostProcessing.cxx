@@ -44,7 +44,10 @@ int main(int argc, const char* argv[])
        "Space-separated timestamps (ms since epoch) which should be given to the post processing task."
        " Effectively, it ignores triggers declared in the configuration file and replaces them with"
        " TriggerType::Manual with given timestamps. The first value is used for initalization trigger, the last for"
-       " finalization, so at least two are required.");
+       " finalization, so at least two are required.")                                                    //
+      ("parallelism", bpo::value<size_t>()->default_value(1),
+       "When running over timestamps, how many updates may be processed at once. Inputs of the upcoming timestamps"
+       " are prefetched in advance, while updates of order-independent tasks are also run in parallel.");
 
     bpo::positional_options_description positionalArgs;
     positionalArgs.add("timestamps", -1);
@@ -78,7 +81,7 @@ int main(int argc, const char* argv[])
 
     if (vm.count("timestamps")) {
       // running the PP task on a set of timestamps
-      runner.runOverTimestamps(vm["timestamps"].as<std::vector<uint64_t>>());
+      runner.runOverTimestamps(vm["timestamps"].as<std::vector<uint64_t>>(), vm["parallelism"].as<size_t>());
     } else {
       // running the PP task with an event loop
       runner.start();
@@ -168,10 +168,8 @@ WorkflowSpec defineDataProcessing(const ConfigContext& config)
     auto infologgerFilterDiscardDebug = configTree.get<bool>("qc.config.infologger.filterDiscardDebug", false);
     auto infologgerDiscardLevel = configTree.get<int>("qc.config.infologger.filterDiscardLevel", 21);
     auto infologgerDiscardFile = configTree.get<std::string>("qc.config.infologger.filterDiscardFile", "");
-    ILOG_INST.filterDiscardDebug(infologgerFilterDiscardDebug);
-    ILOG_INST.filterDiscardLevel(infologgerDiscardLevel);
-    ILOG_INST.filterDiscardSetFile(infologgerDiscardFile.c_str());
-    o2::quality_control::core::QcInfoLogger::setFacility("runQC");
+    // through QcInfoLogger, so that the messages discarded by these filters are not even formatted
+    o2::quality_control::core::QcInfoLogger::init("runQC", infologgerFilterDiscardDebug, infologgerDiscardLevel, infologgerDiscardFile);
 
     ILOG(Info, Ops) << "Using config file '" << qcConfigurationSource << "'" << ENDM;
     auto keyValuesToOverride = quality_control::core::parseOverrideValues(config.options().get<std::string>("override-values"));
@@ -25,6 +25,7 @@
 
 #include <Framework/DataSpecUtils.h>
 #include <Configuration/ConfigurationFactory.h>
+#include <boost/property_tree/ptree.hpp>
 
 using namespace o2::quality_control::core;
 using namespace o2::framework;
@@ -171,6 +172,42 @@ BOOST_AUTO_TEST_CASE(qc_factory_remote_test)
   BOOST_CHECK(aggregator != workflow.end());
 }
 
+BOOST_AUTO_TEST_CASE(qc_factory_remote_auto_mergers_test)
+{
+  std::string configFilePath = std::string("json://") + getTestDataDirectory() + "testSharedConfig.json";
+  auto configInterface = ConfigurationFactory::getConfiguration(configFilePath);
+  auto configTree = configInterface->getRecursive();
+
+  // one Merger cannot merge the objects of 30 machines each 10 seconds at 1 object per second
+  auto& localMachines = configTree.get_child("qc.tasks.skeletonTask.localMachines");
+  localMachines.clear();
+  for (int i = 1; i <= 30; i++) {
+    boost::property_tree::ptree machine;
+    machine.put("", "o2flp" + std::to_string(i));
+    localMachines.push_back({ "", machine });
+  }
+  configTree.put("qc.tasks.skeletonTask.mergersTopology", "auto");
+  configTree.put("qc.tasks.skeletonTask.mergerPerformance", 1);
+  auto workflow = InfrastructureGenerator::generateRemoteInfrastructure(configTree);
+
+  auto mergers = std::count_if(
+    workflow.begin(), workflow.end(),
+    [](const DataProcessorSpec& d) {
+      return d.name.find("MERGER") != std::string::npos;
+    });
+  BOOST_CHECK_GT(mergers, 1);
+
+  // the default topology stays a single Merger
+  configTree.put("qc.tasks.skeletonTask.mergersTopology", "single");
+  auto singleWorkflow = InfrastructureGenerator::generateRemoteInfrastructure(configTree);
+  auto singleMergers = std::count_if(
+    singleWorkflow.begin(), singleWorkflow.end(),
+    [](const DataProcessorSpec& d) {
+      return d.name.find("MERGER") != std::string::npos;
+    });
+  BOOST_CHECK_EQUAL(singleMergers, 1);
+}
+
 BOOST_AUTO_TEST_CASE(qc_factory_standalone_test)
 {
   std::string configFilePath = std::string("json://") + getTestDataDirectory() + "testSharedConfig.json";
@@ -0,0 +1,68 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file    testInfrastructureSpecReader.cxx
+///
+
+#include "getTestDataDirectory.h"
+#include "QualityControl/InfrastructureSpecReader.h"
+#include <Configuration/ConfigurationFactory.h>
+#include <Configuration/ConfigurationInterface.h>
+#include <boost/property_tree/ptree.hpp>
+
+#define BOOST_TEST_MODULE InfrastructureSpecReader test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+using namespace o2::quality_control::core;
+using namespace o2::configuration;
+
+BOOST_AUTO_TEST_CASE(test_read_sections)
+{
+  std::string configFilePath = std::string("json://") + getTestDataDirectory() + "testSharedConfig.json";
+  auto config = ConfigurationFactory::getConfiguration(configFilePath);
+  auto tree = config->getRecursive();
+
+  auto spec = InfrastructureSpecReader::readInfrastructureSpec(tree, InfrastructureSpecReader::CommonSection | InfrastructureSpecReader::AggregatorsSection);
+  BOOST_CHECK_EQUAL(spec.common.monitoringUrl, "infologger:///debug?qc");
+  BOOST_CHECK(spec.tasks.empty());
+  BOOST_CHECK(spec.checks.empty());
+  BOOST_CHECK(spec.postProcessingTasks.empty());
+  BOOST_CHECK(spec.externalTasks.empty());
+  BOOST_CHECK_EQUAL(spec.aggregators.size(), InfrastructureSpecReader::readSectionSpec<checker::AggregatorSpec>(tree, "aggregators").size());
+
+  auto tasksOnly = InfrastructureSpecReader::readInfrastructureSpec(tree, InfrastructureSpecReader::TasksSection);
+  BOOST_CHECK_EQUAL(tasksOnly.tasks.size(), 4);
+  BOOST_CHECK(tasksOnly.common.database.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_read_section_entries)
+{
+  std::string configFilePath = std::string("json://") + getTestDataDirectory() + "testSharedConfig.json";
+  auto config = ConfigurationFactory::getConfiguration(configFilePath);
+  auto tree = config->getRecursive();
+
+  // the task name may differ from its ID
+  auto tasks = InfrastructureSpecReader::readSectionSpec<TaskSpec>(
+    tree, "tasks", [](const std::string& taskID, const boost::property_tree::ptree& taskTree) {
+      return taskTree.get<std::string>("taskName", taskID) == "xyzTask";
+    });
+  BOOST_REQUIRE_EQUAL(tasks.size(), 1);
+  BOOST_CHECK_EQUAL(tasks[0].taskName, "xyzTask");
+  BOOST_CHECK_EQUAL(tasks[0].detectorName, "ITS");
+
+  auto none = InfrastructureSpecReader::readSectionSpec<TaskSpec>(
+    tree, "tasks", [](const std::string&, const boost::property_tree::ptree&) { return false; });
+  BOOST_CHECK(none.empty());
+}
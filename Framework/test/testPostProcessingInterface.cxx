@@ -81,6 +81,9 @@ BOOST_AUTO_TEST_CASE(test_factory)
 
   task.initialize({ TriggerType::No }, services);
   BOOST_CHECK_EQUAL(task.test, 2);
+  BOOST_CHECK(!task.isOrderIndependent());
+  task.prefetch({ TriggerType::No }, services);
+  BOOST_CHECK_EQUAL(task.test, 2);
   task.update({ TriggerType::No }, services);
   BOOST_CHECK_EQUAL(task.test, 3);
   task.finalize({ TriggerType::No }, services);
@@ -16,7 +16,10 @@
 
 #include "getTestDataDirectory.h"
 #include "QualityControl/PostProcessingRunner.h"
+#include "QualityControl/MonitorObject.h"
 #include <Configuration/ConfigurationFactory.h>
+#include <boost/property_tree/ptree.hpp>
+#include <TH1.h>
 
 #define BOOST_TEST_MODULE PostProcessingRunner test
 #define BOOST_TEST_MAIN
@@ -37,4 +40,55 @@ BOOST_AUTO_TEST_CASE(test_factory)
   // todo: this initializes database. should we have an option not to do it, so we don't fail test randomly?
   BOOST_CHECK_NO_THROW(runner.init(config->getRecursive()));
   BOOST_CHECK_NO_THROW(runner.run());
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(test_run_over_timestamps_pipelined)
+{
+  std::string configFilePath = std::string("json://") + getTestDataDirectory() + "testSharedConfig.json";
+  auto config = ConfigurationFactory::getConfiguration(configFilePath);
+
+  PostProcessingRunner runner("SkeletonPostProcessing");
+  std::vector<long> publishedTimestamps;
+  runner.setPublicationCallback([&](const o2::quality_control::core::MonitorObjectCollection*, long from, long) {
+    publishedTimestamps.push_back(from);
+  });
+
+  BOOST_REQUIRE_NO_THROW(runner.init(config->getRecursive()));
+  BOOST_REQUIRE_NO_THROW(runner.runOverTimestamps({ 1, 2, 3, 4, 5, 6 }, 3));
+
+  // updates and finalization, in the order of timestamps
+  std::vector<long> expectedTimestamps{ 2, 3, 4, 5, 6 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(publishedTimestamps.begin(), publishedTimestamps.end(), expectedTimestamps.begin(), expectedTimestamps.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_run_over_timestamps_in_parallel)
+{
+  std::string configFilePath = std::string("json://") + getTestDataDirectory() + "testSharedConfig.json";
+  auto config = ConfigurationFactory::getConfiguration(configFilePath);
+  auto configTree = config->getRecursive();
+  // an order-independent task, which publishes the timestamp of each update
+  auto taskTree = configTree.get_child("qc.postprocessing.SkeletonPostProcessing");
+  taskTree.put("className", "o2::quality_control_modules::example::ExamplePostProcessing");
+  taskTree.put("moduleName", "QcExample");
+  configTree.add_child("qc.postprocessing.ExamplePostProcessing", taskTree);
+
+  PostProcessingRunner runner("ExamplePostProcessing");
+  std::vector<long> publishedTimestamps;
+  std::vector<double> publishedValues;
+  runner.setPublicationCallback([&](const o2::quality_control::core::MonitorObjectCollection* moc, long from, long) {
+    publishedTimestamps.push_back(from);
+    auto mo = dynamic_cast<o2::quality_control::core::MonitorObject*>(moc->FindObject("timestamp"));
+    auto histogram = mo ? dynamic_cast<TH1*>(mo->getObject()) : nullptr;
+    publishedValues.push_back(histogram ? histogram->GetBinContent(1) : -1);
+  });
+
+  BOOST_REQUIRE_NO_THROW(runner.init(configTree));
+  BOOST_REQUIRE_NO_THROW(runner.runOverTimestamps({ 1, 2, 3, 4, 5, 6, 7, 8 }, 3));
+
+  // the updates run in three instances of the task, but they are published in the order of timestamps,
+  // each with the objects of its own update. The finalization publishes the objects of the last update again.
+  std::vector<long> expectedTimestamps{ 2, 3, 4, 5, 6, 7, 8 };
+  std::vector<double> expectedValues{ 2, 3, 4, 5, 6, 7, 7 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(publishedTimestamps.begin(), publishedTimestamps.end(), expectedTimestamps.begin(), expectedTimestamps.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(publishedValues.begin(), publishedValues.end(), expectedValues.begin(), expectedValues.end());
+}
@@ -21,7 +21,9 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 #include <fairlogger/Logger.h>
+#include <cstdio>
 #include <cstdlib>
+#include <unistd.h>
 
 using namespace std;
 using namespace AliceO2::InfoLogger;
@@ -86,6 +88,72 @@ BOOST_AUTO_TEST_CASE(qc_info_logger_fields)
   ILOG(Info, Support) << "Partition set to physics_1, facility=Test, system=QC, detector=ITS" << ENDM;
 }
 
+BOOST_AUTO_TEST_CASE(qc_info_logger_discarded_not_evaluated)
+{
+  int evaluated = 0;
+  auto count = [&evaluated]() { return ++evaluated; };
+
+  QcInfoLogger::init("facility", true, 11);
+  BOOST_CHECK(!QcInfoLogger::isEnabled(InfoLogger::Severity::Debug, InfoLogger::Level::Ops));
+  BOOST_CHECK(!QcInfoLogger::isEnabled(InfoLogger::Severity::Info, InfoLogger::Level::Devel));
+  BOOST_CHECK(QcInfoLogger::isEnabled(InfoLogger::Severity::Info, InfoLogger::Level::Support));
+  ILOG(Debug, Ops) << "discarded debug message " << count() << ENDM;
+  ILOG(Info, Devel) << "discarded devel message " << count() << ENDM;
+  BOOST_CHECK_EQUAL(evaluated, 0);
+  ILOG(Info, Support) << "kept message " << count() << ENDM;
+  BOOST_CHECK_EQUAL(evaluated, 1);
+
+  QcInfoLogger::init("facility", false, 21);
+  ILOG(Debug, Devel) << "kept debug message " << count() << ENDM;
+  BOOST_CHECK_EQUAL(evaluated, 2);
+}
+
+BOOST_AUTO_TEST_CASE(qc_info_logger_enabled_with_discard_file)
+{
+  const std::string discardFile = "/tmp/testQcInfoLogger_discarded_" + std::to_string(getpid()) + ".log";
+  int evaluated = 0;
+  auto count = [&evaluated]() { return ++evaluated; };
+
+  // the discarded messages are written to the file, thus they must be evaluated
+  QcInfoLogger::init("facility", true, 11, discardFile);
+  BOOST_CHECK(QcInfoLogger::isEnabled(InfoLogger::Severity::Debug, InfoLogger::Level::Ops));
+  BOOST_CHECK(QcInfoLogger::isEnabled(InfoLogger::Severity::Info, InfoLogger::Level::Devel));
+  ILOG(Debug, Ops) << "discarded debug message " << count() << ENDM;
+  ILOG(Info, Devel) << "discarded devel message " << count() << ENDM;
+  BOOST_CHECK_EQUAL(evaluated, 2);
+
+  QcInfoLogger::init("facility", true, 11);
+  BOOST_CHECK(!QcInfoLogger::isEnabled(InfoLogger::Severity::Debug, InfoLogger::Level::Ops));
+  BOOST_CHECK(!QcInfoLogger::isEnabled(InfoLogger::Severity::Info, InfoLogger::Level::Devel));
+  BOOST_CHECK(QcInfoLogger::isEnabled(InfoLogger::Severity::Info, InfoLogger::Level::Support));
+
+  QcInfoLogger::init("facility", false, 21);
+  BOOST_CHECK(QcInfoLogger::isEnabled(InfoLogger::Severity::Debug, InfoLogger::Level::Devel));
+  std::remove(discardFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(qc_info_logger_rate_limited)
+{
+  LogRateLimiter limiter{ 2, 3600 };
+  BOOST_CHECK(limiter.acquire());
+  BOOST_CHECK(limiter.acquire());
+  BOOST_CHECK(!limiter.acquire());
+  BOOST_CHECK(!limiter.acquire());
+
+  LogRateLimiter shortLimiter{ 1, 0 };
+  BOOST_CHECK(shortLimiter.acquire());
+  auto permit = shortLimiter.acquire();
+  BOOST_CHECK(permit);
+  BOOST_CHECK_EQUAL(permit.suppressed, 0);
+
+  // the stream is evaluated only for the messages which are let through
+  int logged = 0;
+  for (int i = 0; i < 10; i++) {
+    ILOG_RATE_LIMITED(Info, Support, 3, 3600) << "rate limited message " << ++logged << ENDM;
+  }
+  BOOST_CHECK_EQUAL(logged, 3);
+}
+
 BOOST_AUTO_TEST_CASE(qc_info_logger_dplil)
 {
   AliceO2::InfoLogger::InfoLogger dplInfoLogger;
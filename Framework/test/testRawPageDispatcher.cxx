@@ -0,0 +1,98 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file    testRawPageDispatcher.cxx
+///
+
+#include "QualityControl/RawPageDispatcher.h"
+
+#define BOOST_TEST_MODULE RawPageDispatcher test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+using namespace o2::quality_control::core;
+
+namespace
+{
+struct LinkState {
+  std::map<int, std::vector<size_t>> pagesPerLink; // payload sizes are used as page numbers
+  size_t nPages = 0;
+};
+
+std::vector<RawPage> makePages(size_t nPages, uint16_t nFees)
+{
+  std::vector<RawPage> pages;
+  for (size_t i = 0; i < nPages; i++) {
+    RawPage page;
+    page.payloadSize = i;
+    page.feeId = i % nFees;
+    page.linkId = (i / nFees) % 3;
+    pages.push_back(page);
+  }
+  return pages;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(pages_of_a_link_in_order)
+{
+  auto pages = makePages(1000, 7);
+  RawPageDispatcher<LinkState> dispatcher(4);
+  BOOST_CHECK_EQUAL(dispatcher.getNumberOfWorkers(), 4);
+
+  dispatcher.process(pages, [](const RawPage& page, LinkState& state) {
+    state.pagesPerLink[(page.feeId << 8) | page.linkId].push_back(page.payloadSize);
+    state.nPages++;
+  });
+
+  std::map<int, std::vector<size_t>> pagesPerLink;
+  size_t nPages = 0;
+  size_t worker = 0;
+  dispatcher.merge([&](LinkState& state) {
+    for (auto& [link, linkPages] : state.pagesPerLink) {
+      // a link is processed by a single worker
+      BOOST_CHECK_EQUAL(dispatcher.getWorker(link >> 8, link & 0xff), worker);
+      BOOST_CHECK(pagesPerLink.count(link) == 0);
+      pagesPerLink[link] = linkPages;
+    }
+    nPages += state.nPages;
+    worker++;
+  });
+  BOOST_CHECK_EQUAL(nPages, pages.size());
+  BOOST_CHECK_EQUAL(worker, 4);
+
+  for (auto& [link, linkPages] : pagesPerLink) {
+    BOOST_CHECK(std::is_sorted(linkPages.begin(), linkPages.end()));
+  }
+
+  // the states are reset after merging
+  for (size_t i = 0; i < dispatcher.getNumberOfWorkers(); i++) {
+    BOOST_CHECK_EQUAL(dispatcher.getState(i).nPages, 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(exceptions_are_forwarded)
+{
+  auto pages = makePages(100, 10);
+  RawPageDispatcher<LinkState> dispatcher(3);
+  BOOST_CHECK_THROW(dispatcher.process(pages, [](const RawPage& page, LinkState&) {
+    if (page.payloadSize == 42) {
+      throw std::runtime_error("corrupted page");
+    }
+  }),
+                    std::runtime_error);
+}
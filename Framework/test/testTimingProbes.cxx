@@ -0,0 +1,102 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file    testTimingProbes.cxx
+///
+
+#include "QualityControl/TimingProbes.h"
+
+#include <TH2F.h>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MODULE TimingProbes test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+using namespace o2::quality_control::core;
+
+BOOST_AUTO_TEST_CASE(buckets)
+{
+  for (uint64_t duration : { 0ull, 1ull, 3ull, 4ull, 5ull, 7ull, 8ull, 1000ull, 123456789ull, 1ull << 62 }) {
+    auto bucket = TimingProbe::getBucket(duration);
+    BOOST_REQUIRE_LT(bucket, TimingProbe::NBuckets);
+    BOOST_CHECK_LE(TimingProbe::getBucketLowEdge(bucket), duration);
+    if (bucket + 1 < TimingProbe::NBuckets) {
+      BOOST_CHECK_GT(TimingProbe::getBucketLowEdge(bucket + 1), duration);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(summary)
+{
+  TimingProbe probe("test");
+  BOOST_CHECK_EQUAL(probe.summarize().count, 0);
+
+  // 1 to 1000 us
+  for (uint64_t i = 1; i <= 1000; i++) {
+    probe.add(i * 1000);
+  }
+  auto summary = probe.summarize();
+  BOOST_CHECK_EQUAL(summary.count, 1000);
+  BOOST_CHECK_CLOSE(summary.min, 1, 1e-6);
+  BOOST_CHECK_CLOSE(summary.max, 1000, 1e-6);
+  BOOST_CHECK_CLOSE(summary.mean, 500.5, 1e-6);
+  BOOST_CHECK_CLOSE(summary.p50, 500, 20);
+  BOOST_CHECK_CLOSE(summary.p90, 900, 20);
+  BOOST_CHECK_CLOSE(summary.p99, 990, 20);
+
+  probe.reset();
+  BOOST_CHECK_EQUAL(probe.summarize().count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_use)
+{
+  TimingProbes probes;
+  auto& probe = probes.get("concurrent");
+  BOOST_CHECK_EQUAL(&probe, &probes.get("concurrent"));
+  BOOST_CHECK_EQUAL(probes.size(), 1);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&probe, t]() {
+      for (int i = 0; i < 10000; i++) {
+        probe.add(100 + t);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto summary = probe.summarize();
+  BOOST_CHECK_EQUAL(summary.count, 40000);
+  BOOST_CHECK_CLOSE(summary.min, 0.1, 1e-6);
+  BOOST_CHECK_CLOSE(summary.max, 0.103, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(end_of_cycle)
+{
+  TimingProbes probes;
+  auto* histogram = probes.getSummaryHistogram();
+  {
+    ScopedTimingProbe scope(probes.get("scope"));
+  }
+  probes.get("empty");
+  probes.endOfCycle(nullptr);
+
+  BOOST_CHECK_EQUAL(probes.get("scope").summarize().count, 0);
+  auto bin = histogram->GetXaxis()->FindFixBin("scope");
+  BOOST_CHECK_GT(bin, 0);
+  BOOST_CHECK_GT(histogram->GetBinContent(bin, histogram->GetYaxis()->FindFixBin("max")), 0);
+}
@@ -23,8 +23,10 @@
 #include "Headers/RAWDataHeader.h"
 #include "DPLUtils/DPLRawParser.h"
 #include "DataFormatsCTP/Digits.h"
+#include "Common/GBTWordUnpacker.h"
 #include <Framework/InputRecord.h>
 #include <Framework/InputRecordWalker.h>
+#include <algorithm>
 
 namespace o2::quality_control_modules::ctp
 {
@@ -65,12 +67,12 @@ void CTPRawDataReaderTask::monitorData(o2::framework::ProcessingContext& ctx)
 {
   // get the input
   o2::framework::DPLRawParser parser(ctx.inputs());
-  o2::ctp::gbtword80_t remnant = 0;
-  uint32_t sizegbt = 0;
+  // the unpacker keeps the bits of a diglet spanning two GBT words, also across pages
+  common::GBTWordUnpacker unpacker;
+  using Word = common::GBTWordUnpacker::Word;
   uint32_t orbit0 = 0;
   bool first = true;
-  const o2::ctp::gbtword80_t bcidmask = 0xfff;
-  o2::ctp::gbtword80_t pldmask = 0;
+  const Word bcidmask = 0xfff;
 
   // loop over input
   for (auto it = parser.begin(), end = parser.end(); it != end; ++it) {
@@ -87,100 +89,36 @@ void CTPRawDataReaderTask::monitorData(o2::framework::ProcessingContext& ctx)
     // mHistogram2->Fill(triggerBC);
 
     uint32_t payloadCTP;
+    TH1F* histoMask = nullptr;
     auto feeID = o2::raw::RDHUtils::getFEEID(rdh); // 0 = IR, 1 = TCR
     auto linkCRU = (feeID & 0xf00) >> 8;
     if (linkCRU == o2::ctp::GBTLinkIDIntRec) {
       payloadCTP = o2::ctp::NIntRecPayload;
+      histoMask = mHistoInputs;
     } else if (linkCRU == o2::ctp::GBTLinkIDClassRec) {
       payloadCTP = o2::ctp::NClassPayload;
+      histoMask = mHistoClasses;
     } else {
       LOG(error) << "Unxpected  CTP CRU link:" << linkCRU;
+      continue;
     }
     // LOG(info) << "RDH FEEid: " << feeID << " CTP CRU link:" << linkCRU << " Orbit:" << triggerOrbit << " payloadCTP = " << payloadCTP;
-    pldmask = 0;
-    for (uint32_t i = 0; i < payloadCTP; i++) {
-      pldmask[12 + i] = 1;
-    }
+    // the payload follows the 12 bits of the BC id, within the 80 bits of a GBT word
+    const Word pldmask = common::GBTWordUnpacker::lowBitsMask(std::min(12 + payloadCTP, common::GBTWordUnpacker::GBTWordBits)) & ~bcidmask;
     gsl::span<const uint8_t> payload(it.data(), it.size());
-    o2::ctp::gbtword80_t gbtWord = 0;
-    int wordCount = 0;
-    std::vector<o2::ctp::gbtword80_t> diglets;
 
     // === according to O2: Detectors/CTP/workflow/src/RawToDigitConverterSpec.cxx ========
-    for (auto payloadWord : payload) {
-      if (wordCount == 15) {
-        wordCount = 0;
-      } else if (wordCount > 9) {
-        wordCount++;
-      } else if (wordCount == 9) {
-        for (int i = 0; i < 8; i++) {
-          gbtWord[wordCount * 8 + i] = bool(int(payloadWord) & (1 << i));
-        }
-        wordCount++;
-        diglets.clear();
-        o2::ctp::gbtword80_t diglet = remnant;
-        uint32_t k = 0;
-        const uint32_t nGBT = o2::ctp::NGBT;
-        while (k < (nGBT - payloadCTP)) {
-          std::bitset<nGBT> masksize = 0;
-          for (uint32_t j = 0; j < (payloadCTP - sizegbt); j++) {
-            masksize[j] = 1;
-          }
-          diglet |= (gbtWord & masksize) << (sizegbt);
-          diglets.push_back(diglet);
-          diglet = 0;
-          k += payloadCTP - sizegbt;
-          gbtWord = gbtWord >> (payloadCTP - sizegbt);
-          sizegbt = 0;
-        }
-        sizegbt = nGBT - k;
-        remnant = gbtWord;
-        // ==========================================
-        // LOG(info) << " gbtword after:" << gbtWord;
-        for (auto diglet : diglets) {
-          // LOG(info) << " diglet:" << diglet;
-          // LOG(info) << " pldmask:" << pldmask;
-          o2::ctp::gbtword80_t pld = (diglet & pldmask);
-          if (pld.count() == 0) {
-            continue;
-          }
-          // LOG(info) << "    pld:" << pld;
-          pld >>= 12;
-          uint32_t bcid = (diglet & bcidmask).to_ulong();
-          // LOG(info) << " diglet:" << diglet;
-          // LOG(info) << " bcid:" << bcid;
-          mHistoBC->Fill(bcid);
-
-          o2::ctp::gbtword80_t inputMask = 0;
-          if (linkCRU == o2::ctp::GBTLinkIDIntRec) {
-            inputMask = pld;
-            // LOG(info) << " InputMask:" << inputMask;
-            for (Int_t i = 0; i < payloadCTP; i++) {
-              if (inputMask[i] != 0) {
-                mHistoInputs->Fill(i);
-              }
-            }
-          }
-
-          o2::ctp::gbtword80_t classMask = 0;
-          if (linkCRU == o2::ctp::GBTLinkIDClassRec) {
-            classMask = pld;
-            // LOG(info) << " ClassMask:" << classMask;
-            for (Int_t i = 0; i < payloadCTP; i++) {
-              if (classMask[i] != 0) {
-                mHistoClasses->Fill(i);
-              }
-            }
-          }
-        }
-        gbtWord = 0;
-      } else {
-        for (int i = 0; i < 8; i++) {
-          gbtWord[wordCount * 8 + i] = bool(int(payloadWord) & (1 << i));
-        }
-        wordCount++;
+    unpacker.unpack(payload, payloadCTP, [&](Word diglet) {
+      Word pld = diglet & pldmask;
+      if (pld == 0) {
+        return;
       }
-    }
+      pld >>= 12;
+      uint32_t bcid = uint32_t(diglet & bcidmask);
+      mHistoBC->Fill(bcid);
+      // the inputs or classes which fired are the bits set in the payload
+      common::GBTWordUnpacker::forEachSetBit(pld, [histoMask](int i) { histoMask->Fill(i); });
+    });
   }
 }
 
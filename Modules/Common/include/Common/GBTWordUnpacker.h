@@ -0,0 +1,112 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   GBTWordUnpacker.h
+///
+
+#ifndef QC_MODULE_COMMON_GBTWORDUNPACKER_H
+#define QC_MODULE_COMMON_GBTWORDUNPACKER_H
+
+#include <cstdint>
+#include <cstring>
+#include <gsl/span>
+
+namespace o2::quality_control_modules::common
+{
+
+/// \brief Unpacks fixed-size records out of a stream of GBT words.
+///
+/// A GBT word carries 80 bits of data and is padded to 16 bytes in the raw payload. The records are packed
+/// contiguously, thus a record may start in a GBT word and end in the next one. The bits left at the end of
+/// a GBT word are kept and prepended to the first record of the next one, also across calls to unpack().
+/// The words are handled as 128-bit integers, so that a record is extracted with one mask and one shift.
+class GBTWordUnpacker
+{
+ public:
+  using Word = unsigned __int128;
+
+  static constexpr uint32_t GBTWordBits = 80;
+  static constexpr size_t GBTWordBytes = 10;
+  static constexpr size_t GBTWordPaddedBytes = 16;
+
+  /// \brief Returns a word with the nBits least significant bits set
+  static constexpr Word lowBitsMask(uint32_t nBits)
+  {
+    return nBits >= 128 ? ~Word(0) : (Word(1) << nBits) - 1;
+  }
+
+  /// \brief Reads the 80 bits of a GBT word stored in little endian
+  static Word readGBTWord(const uint8_t* data)
+  {
+    uint64_t low;
+    std::memcpy(&low, data, sizeof(low));
+    uint64_t high = data[8] | (uint64_t(data[9]) << 8);
+    return (Word(high) << 64) | low;
+  }
+
+  /// \brief Returns the number of bits set in a word
+  static int popcount(Word word)
+  {
+    return __builtin_popcountll(uint64_t(word)) + __builtin_popcountll(uint64_t(word >> 64));
+  }
+
+  /// \brief Calls f(index) for each bit set in the word, in increasing order
+  template <typename F>
+  static void forEachSetBit(Word word, F&& f)
+  {
+    for (int offset = 0; offset < 128; offset += 64) {
+      auto bits = uint64_t(word >> offset);
+      while (bits) {
+        f(offset + __builtin_ctzll(bits));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+  /// \brief Calls onRecord(record) for each record of recordBits bits (1 to 80) found in the payload.
+  /// An incomplete GBT word at the end of the payload is ignored.
+  template <typename F>
+  void unpack(gsl::span<const uint8_t> payload, uint32_t recordBits, F&& onRecord)
+  {
+    for (size_t offset = 0; offset + GBTWordBytes <= payload.size(); offset += GBTWordPaddedBytes) {
+      Word gbtWord = readGBTWord(payload.data() + offset);
+      Word record = mRemnant;
+      uint32_t usedBits = 0;
+      while (usedBits < GBTWordBits - recordBits) {
+        uint32_t nBits = recordBits - mRemnantBits;
+        record |= (gbtWord & lowBitsMask(nBits)) << mRemnantBits;
+        onRecord(record);
+        record = 0;
+        usedBits += nBits;
+        gbtWord >>= nBits;
+        mRemnantBits = 0;
+      }
+      mRemnantBits = GBTWordBits - usedBits;
+      mRemnant = gbtWord;
+    }
+  }
+
+  /// \brief Drops the bits kept from the last GBT word
+  void reset()
+  {
+    mRemnant = 0;
+    mRemnantBits = 0;
+  }
+
+ private:
+  Word mRemnant = 0;
+  uint32_t mRemnantBits = 0;
+};
+
+} // namespace o2::quality_control_modules::common
+
+#endif // QC_MODULE_COMMON_GBTWORDUNPACKER_H
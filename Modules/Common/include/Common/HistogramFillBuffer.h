@@ -0,0 +1,119 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   HistogramFillBuffer.h
+///
+
+#ifndef QC_MODULE_COMMON_HISTOGRAMFILLBUFFER_H
+#define QC_MODULE_COMMON_HISTOGRAMFILLBUFFER_H
+
+#include <TH1.h>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace o2::quality_control_modules::common
+{
+
+/// \brief Collects the entries of a 1D or 2D histogram and fills them in batches with FillN.
+///
+/// Tasks which fill a few histograms for each channel of each bunch crossing spend a large part of their
+/// time in the virtual calls to TH1::Fill. The entries are kept in contiguous arrays instead and given to the
+/// histogram in one call, when the buffer is full or when flush() is called. The histogram content,
+/// including the statistics, is the same as with one Fill per entry.
+/// flush() must be called before the histogram is read, typically at the end of monitorData(). The pending
+/// entries are not flushed on destruction, as the histogram might already be deleted.
+template <int NDim>
+class HistogramFillBuffer
+{
+  static_assert(NDim == 1 || NDim == 2, "only 1D and 2D histograms are supported");
+
+ public:
+  static constexpr std::size_t DefaultCapacity = 1 << 14;
+
+  HistogramFillBuffer() = default;
+  explicit HistogramFillBuffer(TH1* histo, std::size_t capacity = DefaultCapacity)
+  {
+    setHistogram(histo, capacity);
+  }
+  HistogramFillBuffer(const HistogramFillBuffer&) = delete;
+  HistogramFillBuffer& operator=(const HistogramFillBuffer&) = delete;
+
+  /// \brief Sets the histogram to be filled, the pending entries of the previous one are flushed first
+  void setHistogram(TH1* histo, std::size_t capacity = DefaultCapacity)
+  {
+    flush();
+    mHisto = histo;
+    mCapacity = capacity > 0 ? capacity : 1;
+    for (auto& coordinates : mCoordinates) {
+      coordinates.reserve(mCapacity);
+    }
+  }
+
+  void fill(double x)
+  {
+    static_assert(NDim == 1, "fill(x) is only available for 1D histograms");
+    mCoordinates[0].push_back(x);
+    flushIfFull();
+  }
+
+  void fill(double x, double y)
+  {
+    static_assert(NDim == 2, "fill(x, y) is only available for 2D histograms");
+    mCoordinates[0].push_back(x);
+    mCoordinates[1].push_back(y);
+    flushIfFull();
+  }
+
+  /// \brief Fills the histogram with the pending entries
+  void flush()
+  {
+    if (mHisto != nullptr && size() > 0) {
+      if constexpr (NDim == 1) {
+        mHisto->FillN(size(), mCoordinates[0].data(), nullptr);
+      } else {
+        mHisto->FillN(size(), mCoordinates[0].data(), mCoordinates[1].data(), nullptr);
+      }
+    }
+    clear();
+  }
+
+  /// \brief Drops the pending entries
+  void clear()
+  {
+    for (auto& coordinates : mCoordinates) {
+      coordinates.clear();
+    }
+  }
+
+  std::size_t size() const { return mCoordinates[0].size(); }
+  TH1* getHistogram() const { return mHisto; }
+
+ private:
+  void flushIfFull()
+  {
+    if (size() >= mCapacity) {
+      flush();
+    }
+  }
+
+  TH1* mHisto = nullptr;
+  std::size_t mCapacity = DefaultCapacity;
+  std::array<std::vector<double>, NDim> mCoordinates;
+};
+
+using HistogramFillBuffer1D = HistogramFillBuffer<1>;
+using HistogramFillBuffer2D = HistogramFillBuffer<2>;
+
+} // namespace o2::quality_control_modules::common
+
+#endif // QC_MODULE_COMMON_HISTOGRAMFILLBUFFER_H
@@ -0,0 +1,77 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   testGBTWordUnpacker.cxx
+///
+
+#include "Common/GBTWordUnpacker.h"
+
+#define BOOST_TEST_MODULE GBTWordUnpacker test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+namespace o2::quality_control_modules::common
+{
+
+using Word = GBTWordUnpacker::Word;
+
+BOOST_AUTO_TEST_CASE(set_bits)
+{
+  Word word = (Word(1) << 3) | (Word(1) << 64) | (Word(1) << 79);
+  std::vector<int> bits;
+  GBTWordUnpacker::forEachSetBit(word, [&bits](int bit) { bits.push_back(bit); });
+  BOOST_CHECK(bits == std::vector<int>({ 3, 64, 79 }));
+  BOOST_CHECK_EQUAL(GBTWordUnpacker::popcount(word), 3);
+  BOOST_CHECK_EQUAL(GBTWordUnpacker::popcount(GBTWordUnpacker::lowBitsMask(80)), 80);
+}
+
+BOOST_AUTO_TEST_CASE(records_spanning_gbt_words)
+{
+  const uint32_t recordBits = 60;
+  std::vector<Word> records;
+  for (uint64_t i = 0; i < 4; i++) {
+    records.push_back((Word(0xabc + i) << 48) | (Word(i + 1) << 12) | (0x100 + i));
+  }
+
+  // pack the records contiguously in 3 GBT words, each padded to 16 bytes
+  std::vector<uint8_t> payload(3 * GBTWordUnpacker::GBTWordPaddedBytes, 0);
+  for (size_t bit = 0; bit < records.size() * recordBits; bit++) {
+    if ((records[bit / recordBits] >> (bit % recordBits)) & 1) {
+      size_t word = bit / GBTWordUnpacker::GBTWordBits;
+      size_t bitInWord = bit % GBTWordUnpacker::GBTWordBits;
+      payload[word * GBTWordUnpacker::GBTWordPaddedBytes + bitInWord / 8] |= 1 << (bitInWord % 8);
+    }
+  }
+  // the padding bytes must be ignored
+  payload[GBTWordUnpacker::GBTWordBytes] = 0xff;
+
+  GBTWordUnpacker unpacker;
+  std::vector<Word> unpacked;
+  unpacker.unpack(payload, recordBits, [&unpacked](Word record) { unpacked.push_back(record); });
+
+  // the last record fills the remaining 60 bits of the third word and is emitted with the next GBT word
+  BOOST_REQUIRE_EQUAL(unpacked.size(), 3);
+  for (size_t i = 0; i < unpacked.size(); i++) {
+    BOOST_CHECK(unpacked[i] == records[i]);
+  }
+
+  std::vector<uint8_t> nextWord(GBTWordUnpacker::GBTWordPaddedBytes, 0);
+  unpacker.unpack(nextWord, recordBits, [&unpacked](Word record) { unpacked.push_back(record); });
+  BOOST_REQUIRE_EQUAL(unpacked.size(), 5);
+  BOOST_CHECK(unpacked[3] == records[3]);
+  BOOST_CHECK(unpacked[4] == 0);
+}
+
+} // namespace o2::quality_control_modules::common
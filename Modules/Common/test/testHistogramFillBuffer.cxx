@@ -0,0 +1,67 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   testHistogramFillBuffer.cxx
+///
+
+#include "Common/HistogramFillBuffer.h"
+
+#include <TH1F.h>
+#include <TH2F.h>
+
+#define BOOST_TEST_MODULE HistogramFillBuffer test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+namespace o2::quality_control_modules::common
+{
+
+BOOST_AUTO_TEST_CASE(fill_1d)
+{
+  TH1F reference("reference", "reference", 10, 0, 10);
+  TH1F buffered("buffered", "buffered", 10, 0, 10);
+  HistogramFillBuffer1D buffer(&buffered, 7);
+  for (int i = 0; i < 100; i++) {
+    reference.Fill(i % 12 - 0.5);
+    buffer.fill(i % 12 - 0.5);
+  }
+  // the buffer is flushed when it is full only
+  BOOST_CHECK_EQUAL(buffer.size(), 100 % 7);
+  buffer.flush();
+  BOOST_CHECK_EQUAL(buffer.size(), 0);
+
+  BOOST_CHECK_EQUAL(buffered.GetEntries(), reference.GetEntries());
+  BOOST_CHECK_CLOSE(buffered.GetMean(), reference.GetMean(), 1e-6);
+  for (int bin = 0; bin <= reference.GetNbinsX() + 1; bin++) {
+    BOOST_CHECK_EQUAL(buffered.GetBinContent(bin), reference.GetBinContent(bin));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(fill_2d)
+{
+  TH2F reference("reference2d", "reference2d", 10, 0, 10, 5, 0, 5);
+  TH2F buffered("buffered2d", "buffered2d", 10, 0, 10, 5, 0, 5);
+  HistogramFillBuffer2D buffer(&buffered);
+  for (int i = 0; i < 100; i++) {
+    reference.Fill(i % 10, i % 7);
+    buffer.fill(i % 10, i % 7);
+  }
+  buffer.flush();
+
+  BOOST_CHECK_EQUAL(buffered.GetEntries(), reference.GetEntries());
+  for (int bin = 0; bin < reference.GetNcells(); bin++) {
+    BOOST_CHECK_EQUAL(buffered.GetBinContent(bin), reference.GetBinContent(bin));
+  }
+}
+
+} // namespace o2::quality_control_modules::common
@@ -20,6 +20,7 @@
 #include "QualityControl/TaskInterface.h"
 #include <array>
 #include <unordered_map>
+#include <vector>
 #include <string_view>
 #include <gsl/span>
 #include <CCDB/TObjectWrapper.h>
@@ -96,7 +97,7 @@ class CellTask final : public TaskInterface
     void reset();
     void clean();
 
-    void fillHistograms(const o2::emcal::Cell& cell, bool isGood, double timeoffset, int bcphase);
+    void fillHistograms(const o2::emcal::Cell& cell, bool isGood, double timeoffset, int bcphase, int supermoduleID, int row, int col);
     void countEvent();
   };
 
@@ -143,13 +144,33 @@ class CellTask final : public TaskInterface
       return mSubevents.size();
     };
   };
+
+  /// \brief Trigger classes monitored, used as index of the histogram container
+  enum TriggerClass {
+    kTrgCAL,
+    kTrgPHYS,
+    kNTriggerClasses
+  };
+
+  /// \brief Constants of each tower, stored in arrays indexed by the tower ID
+  struct TowerTables {
+    std::vector<int> mSupermodule;                 ///< Supermodule ID, -1 for invalid towers
+    std::vector<int> mRow;                         ///< Global row, -1 for invalid towers
+    std::vector<int> mColumn;                      ///< Global column, -1 for invalid towers
+    std::array<std::vector<float>, 2> mTimeOffset; ///< Time calibration offset for high [0] and low [1] gain
+    std::vector<char> mGoodCell;                   ///< Good/bad flag from the bad channel map
+  };
+  void buildGeometryTables();
+  void buildCalibrationTables();
+
   std::vector<CombinedEvent> buildCombinedEvents(const std::unordered_map<header::DataHeader::SubSpecificationType, gsl::span<const o2::emcal::TriggerRecord>>& triggerrecords) const;
-  Bool_t mIgnoreTriggerTypes = false;                        ///< Do not differenciate between trigger types, treat all triggers as phys. triggers
-  std::map<std::string, CellHistograms> mHistogramContainer; ///< Container with histograms per trigger class
-  o2::emcal::Geometry* mGeometry = nullptr;                  ///< EMCAL geometry
-  o2::emcal::BadChannelMap* mBadChannelMap;                  ///< EMCAL channel map
-  o2::emcal::TimeCalibrationParams* mTimeCalib;              ///< EMCAL time calib
-  int mTimeFramesPerCycles = 0;                              ///< TF per cycles
+  Bool_t mIgnoreTriggerTypes = false;                               ///< Do not differenciate between trigger types, treat all triggers as phys. triggers
+  std::array<CellHistograms, kNTriggerClasses> mHistogramContainer; ///< Container with histograms per trigger class
+  TowerTables mTowerTables;                                         ///< Geometry and calibration constants per tower
+  o2::emcal::Geometry* mGeometry = nullptr;                         ///< EMCAL geometry
+  o2::emcal::BadChannelMap* mBadChannelMap = nullptr;               ///< EMCAL channel map
+  o2::emcal::TimeCalibrationParams* mTimeCalib = nullptr;           ///< EMCAL time calib
+  int mTimeFramesPerCycles = 0;                                     ///< TF per cycles
 
   TH1* mEvCounterTF = nullptr;      ///< Number of Events per timeframe
   TH1* mEvCounterTFPHYS = nullptr;  ///< Number of Events per timeframe per PHYS
@@ -46,8 +46,8 @@ namespace emcal
 
 CellTask::~CellTask()
 {
-  for (auto en : mHistogramContainer) {
-    en.second.clean();
+  for (auto& histos : mHistogramContainer) {
+    histos.clean();
   }
   if (mEvCounterTF)
     delete mEvCounterTF;
@@ -124,14 +124,19 @@ void CellTask::initialize(o2::framework::InitContext& /*ctx*/)
   if (!mGeometry)
     mGeometry = o2::emcal::Geometry::GetInstanceFromRunNumber(300000);
 
-  std::array<std::string, 2> triggers = { { "CAL", "PHYS" } };
-  for (const auto& trg : triggers) {
+  buildGeometryTables();
+  buildCalibrationTables();
+
+  std::array<std::string, kNTriggerClasses> triggers;
+  triggers[kTrgCAL] = "CAL";
+  triggers[kTrgPHYS] = "PHYS";
+  for (int itrg = 0; itrg < kNTriggerClasses; itrg++) {
     CellHistograms histos;
-    histos.mCellThreshold = (trg == "CAL") ? thresholdCAL : thresholdPHYS;
+    histos.mCellThreshold = (itrg == kTrgCAL) ? thresholdCAL : thresholdPHYS;
     histos.mGeometry = mGeometry;
-    histos.initForTrigger(trg.data(), hasAmpVsCell, hasTimeVsCell, hasCalib2D);
+    histos.initForTrigger(triggers[itrg], hasAmpVsCell, hasTimeVsCell, hasCalib2D);
     histos.startPublishing(*getObjectsManager());
-    mHistogramContainer[trg] = histos;
+    mHistogramContainer[itrg] = histos;
   } // trigger type
   // new histos
   mTFPerCyclesTOT = new TH1D("NumberOfTFperCycles_TOT", "NumberOfTFperCycles_TOT", 100, -0.5, 99.5); //
@@ -227,6 +232,47 @@ void CellTask::startOfCycle()
   //"EMC/TimeCalibrationParams
   if (!mTimeCalib)
     ILOG(Info, Support) << " No Time Calib object " << ENDM;
+
+  buildCalibrationTables();
+}
+
+void CellTask::buildGeometryTables()
+{
+  auto ntowers = mGeometry->GetNCells();
+  mTowerTables.mSupermodule.assign(ntowers, -1);
+  mTowerTables.mRow.assign(ntowers, -1);
+  mTowerTables.mColumn.assign(ntowers, -1);
+  for (int tower = 0; tower < ntowers; tower++) {
+    try {
+      auto [row, col] = mGeometry->GlobalRowColFromIndex(tower);
+      mTowerTables.mRow[tower] = row;
+      mTowerTables.mColumn[tower] = col;
+    } catch (o2::emcal::InvalidCellIDException& e) {
+    }
+    try {
+      mTowerTables.mSupermodule[tower] = std::get<0>(mGeometry->GetCellIndex(tower));
+    } catch (o2::emcal::InvalidCellIDException& e) {
+    }
+  }
+}
+
+void CellTask::buildCalibrationTables()
+{
+  using MaskType_t = o2::emcal::BadChannelMap::MaskType_t;
+  auto ntowers = mTowerTables.mSupermodule.size();
+  for (auto& offsets : mTowerTables.mTimeOffset) {
+    offsets.assign(ntowers, 0.);
+  }
+  mTowerTables.mGoodCell.assign(ntowers, true);
+  for (std::size_t tower = 0; tower < ntowers; tower++) {
+    if (mTimeCalib) {
+      mTowerTables.mTimeOffset[0][tower] = mTimeCalib->getTimeCalibParam(tower, false);
+      mTowerTables.mTimeOffset[1][tower] = mTimeCalib->getTimeCalibParam(tower, true);
+    }
+    if (mBadChannelMap) {
+      mTowerTables.mGoodCell[tower] = mBadChannelMap->getChannelStatus(tower) != MaskType_t::GOOD_CELL;
+    }
+  }
 }
 
 void CellTask::monitorData(o2::framework::ProcessingContext& ctx)
@@ -234,7 +280,6 @@ void CellTask::monitorData(o2::framework::ProcessingContext& ctx)
   mTFPerCycles->Fill(1); // number of timeframe process per cycle
   mTimeFramesPerCycles++;
   // check if we have payoad
-  using MaskType_t = o2::emcal::BadChannelMap::MaskType_t;
 
   // Handling of inputs from multiple subevents (multiple FLPs)
   // Build maps of trigger records and cells according to the subspecification
@@ -286,20 +331,20 @@ void CellTask::monitorData(o2::framework::ProcessingContext& ctx)
     auto triggertype = trg.mTriggerType;
     bool isPhysTrigger = mIgnoreTriggerTypes || (triggertype & o2::trigger::PhT),
          isCalibTrigger = (!mIgnoreTriggerTypes) && (triggertype & o2::trigger::Cal);
-    std::string trgClass;
+    TriggerClass trgClass;
     if (isPhysTrigger) {
-      trgClass = "PHYS";
+      trgClass = kTrgPHYS;
       eventcounterPHYS++;
     } else if (isCalibTrigger) {
-      trgClass = "CAL";
+      trgClass = kTrgCAL;
       eventcounterCALIB++;
     } else {
-      ILOG(Error, Support) << " Unmonitored trigger class requested " << ENDM;
+      ILOG_RATE_LIMITED(Error, Support, 10, 60) << " Unmonitored trigger class requested " << ENDM;
       continue;
     }
 
     auto bcphase = trg.mInteractionRecord.bc % 4; // to be fixed:4 histos for EMCAL, 4 histos for DCAL
-    auto histos = mHistogramContainer[trgClass];
+    auto& histos = mHistogramContainer[trgClass];
     std::fill(numCellsSM.begin(), numCellsSM.end(), 0);
     std::fill(numCellsSM_Thres.begin(), numCellsSM_Thres.end(), 0);
 
@@ -307,21 +352,22 @@ void CellTask::monitorData(o2::framework::ProcessingContext& ctx)
     for (auto& subev : trg.mSubevents) {
       auto cellsSubspec = cellSubEvents.find(subev.mSpecification);
       if (cellsSubspec == cellSubEvents.end()) {
-        ILOG(Error, Support) << "No cell data found for subspecification " << subev.mSpecification << ENDM;
+        ILOG_RATE_LIMITED(Error, Support, 10, 60) << "No cell data found for subspecification " << subev.mSpecification << ENDM;
       } else {
         ILOG(Debug, Support) << subev.mCellRange.getEntries() << " cells in subevent from equipment " << subev.mSpecification << ENDM;
         gsl::span<const o2::emcal::Cell> eventcells(cellsSubspec->second.data() + subev.mCellRange.getFirstEntry(), subev.mCellRange.getEntries());
-        for (auto cell : eventcells) {
-          // int index = cell.getHighGain() ? 0 : (cell.getLowGain() ? 1 : -1);
-          int index = cell.getHighGain() ? 0 : 1;
-          auto timeoffset = mTimeCalib ? mTimeCalib->getTimeCalibParam(cell.getTower(), cell.getLowGain()) : 0.;
-          bool goodcell = true;
-          if (mBadChannelMap) {
-            goodcell = mBadChannelMap->getChannelStatus(cell.getTower()) != MaskType_t::GOOD_CELL;
+        for (const auto& cell : eventcells) {
+          // all the tower constants come from the tables built at initialization and when the calibration objects are retrieved
+          std::size_t tower = cell.getTower();
+          if (tower >= mTowerTables.mSupermodule.size()) {
+            ILOG_RATE_LIMITED(Error, Support, 10, 60) << "Invalid cell ID: " << tower << ENDM;
+            continue;
           }
-          histos.fillHistograms(cell, goodcell, timeoffset, bcphase);
-          if (isPhysTrigger) {
-            auto [sm, mod, iphi, ieta] = mGeometry->GetCellIndex(cell.getTower());
+          auto timeoffset = mTowerTables.mTimeOffset[cell.getLowGain() ? 1 : 0][tower];
+          bool goodcell = mTowerTables.mGoodCell[tower];
+          auto sm = mTowerTables.mSupermodule[tower];
+          histos.fillHistograms(cell, goodcell, timeoffset, bcphase, sm, mTowerTables.mRow[tower], mTowerTables.mColumn[tower]);
+          if (isPhysTrigger && sm >= 0) {
             numCellsSM[sm]++;
             if (cell.getEnergy() > mCellThreshold)
               numCellsSM_Thres[sm]++;
@@ -385,8 +431,8 @@ void CellTask::reset()
   // clean all the monitor objects here
 
   ILOG(Debug, Support) << "Resetting the histogram" << ENDM;
-  for (auto cont : mHistogramContainer) {
-    cont.second.reset();
+  for (auto& histos : mHistogramContainer) {
+    histos.reset();
   }
   if (mEvCounterTF)
     mEvCounterTF->Reset();
@@ -577,7 +623,7 @@ void CellTask::CellHistograms::initForTrigger(const std::string trigger, bool ha
   }
 }
 
-void CellTask::CellHistograms::fillHistograms(const o2::emcal::Cell& cell, bool goodCell, double timecalib, int bcphase)
+void CellTask::CellHistograms::fillHistograms(const o2::emcal::Cell& cell, bool goodCell, double timecalib, int bcphase, int supermoduleID, int row, int col)
 {
   auto fillOptional1D = [](TH1* hist, double x, double weight = 1.) {
     if (hist)
@@ -600,8 +646,7 @@ void CellTask::CellHistograms::fillHistograms(const o2::emcal::Cell& cell, bool
   fillOptional2D(mCellTime, cell.getTimeStamp(), cell.getTower());
   // fillOptional2D(mCellTime[index], cell.getTimeStamp(), cell.getTower());
 
-  try {
-    auto [row, col] = mGeometry->GlobalRowColFromIndex(cell.getTower());
+  if (row >= 0) {
     if (cell.getEnergy() > 0) {
       fillOptional2D(mCellOccupancy, col, row);
     }
@@ -613,13 +658,11 @@ void CellTask::CellHistograms::fillHistograms(const o2::emcal::Cell& cell, bool
 
     fillOptional2D(mIntegratedOccupancy, col, row, cell.getEnergy());
 
-  } catch (o2::emcal::InvalidCellIDException& e) {
-    ILOG(Error, Support) << "Invalid cell ID: " << e.getCellID() << ENDM;
+  } else {
+    ILOG_RATE_LIMITED(Error, Support, 10, 60) << "Invalid cell ID: " << cell.getTower() << ENDM;
   };
 
-  try {
-    auto cellindices = mGeometry->GetCellIndex(cell.getTower());
-    auto supermoduleID = std::get<0>(cellindices);
+  if (supermoduleID >= 0) {
     fillOptional2D(mCellAmpSupermodule, cell.getEnergy(), supermoduleID);
     if (cell.getEnergy() > 0.3)
       fillOptional2D(mCellTimeSupermodule, cell.getTimeStamp(), supermoduleID);
@@ -650,12 +693,11 @@ void CellTask::CellHistograms::fillHistograms(const o2::emcal::Cell& cell, bool
     if (cell.getEnergy() > 0.15) {
       auto bchistos = mCellTimeBC.find(bcphase);
       if (bchistos != mCellTimeBC.end()) {
-        auto histcontainer = bchistos->second;
-        histcontainer[supermoduleID]->Fill(cell.getTimeStamp());
+        bchistos->second[supermoduleID]->Fill(cell.getTimeStamp());
       }
     }
-  } catch (o2::emcal::InvalidCellIDException& e) {
-    ILOG(Info, Support) << "Invalid cell ID: " << e.getCellID() << ENDM;
+  } else {
+    ILOG_RATE_LIMITED(Info, Support, 10, 60) << "Invalid cell ID: " << cell.getTower() << ENDM;
   }
 }
 
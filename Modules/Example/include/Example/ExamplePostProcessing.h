@@ -0,0 +1,48 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   ExamplePostProcessing.h
+///
+
+#ifndef QC_MODULE_EXAMPLE_EXAMPLEPOSTPROCESSING_H
+#define QC_MODULE_EXAMPLE_EXAMPLEPOSTPROCESSING_H
+
+#include "QualityControl/PostProcessingInterface.h"
+#include <memory>
+
+class TH1F;
+
+namespace o2::quality_control_modules::example
+{
+
+/// \brief Example of a post-processing task whose updates do not depend on each other.
+///
+/// Each update publishes the timestamp of its trigger, without accumulating anything across updates. Thus the task
+/// declares itself as order-independent and its updates may run in parallel when reprocessing many timestamps.
+class ExamplePostProcessing final : public quality_control::postprocessing::PostProcessingInterface
+{
+ public:
+  ExamplePostProcessing() = default;
+  ~ExamplePostProcessing() override;
+
+  void initialize(quality_control::postprocessing::Trigger, framework::ServiceRegistry&) override;
+  void update(quality_control::postprocessing::Trigger, framework::ServiceRegistry&) override;
+  void finalize(quality_control::postprocessing::Trigger, framework::ServiceRegistry&) override;
+  bool isOrderIndependent() const override { return true; }
+
+ private:
+  std::unique_ptr<TH1F> mTimestamp;
+};
+
+} // namespace o2::quality_control_modules::example
+
+#endif //QC_MODULE_EXAMPLE_EXAMPLEPOSTPROCESSING_H
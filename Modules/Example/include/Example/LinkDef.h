@@ -10,4 +10,5 @@
 #pragma link C++ class o2::quality_control_modules::example::CustomTH2F + ;
 #pragma link C++ class o2::quality_control_modules::example::AnalysisTask + ;
 #pragma link C++ class o2::quality_control_modules::example::EveryObject+;
+#pragma link C++ class o2::quality_control_modules::example::ExamplePostProcessing + ;
 #endif
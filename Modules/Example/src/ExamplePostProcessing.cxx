@@ -0,0 +1,46 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   ExamplePostProcessing.cxx
+///
+
+#include "Example/ExamplePostProcessing.h"
+#include "QualityControl/QcInfoLogger.h"
+
+#include <TH1F.h>
+
+using namespace o2::quality_control::postprocessing;
+
+namespace o2::quality_control_modules::example
+{
+
+ExamplePostProcessing::~ExamplePostProcessing() = default;
+
+void ExamplePostProcessing::initialize(Trigger, framework::ServiceRegistry&)
+{
+  mTimestamp = std::make_unique<TH1F>("timestamp", "Timestamp of the trigger", 1, 0, 1);
+  mTimestamp->SetDirectory(nullptr);
+  getObjectsManager()->startPublishing(mTimestamp.get());
+}
+
+void ExamplePostProcessing::update(Trigger t, framework::ServiceRegistry&)
+{
+  ILOG(Debug, Devel) << "Updating for the timestamp " << t.timestamp << ENDM;
+  mTimestamp->SetBinContent(1, t.timestamp);
+}
+
+void ExamplePostProcessing::finalize(Trigger, framework::ServiceRegistry&)
+{
+  // the object of the last update is published once more at finalization
+}
+
+} // namespace o2::quality_control_modules::example
@@ -14,6 +14,7 @@
 /// \author My Name
 /// LATEST modification for FDD on 24.05.2022 (akhuntia@cern.ch)
 
+#include <algorithm>
 #include <TCanvas.h>
 #include <TH1.h>
 #include "QualityControl/QcInfoLogger.h"
@@ -240,6 +241,38 @@ void DigitQcTask::initialize(o2::framework::InitContext& /*ctx*/)
   getObjectsManager()->setDefaultDrawOptions(mHistOrbitVsTrg.get(), "COLZ");
   getObjectsManager()->startPublishing(mHistOrbitVsFEEmodules.get());
   getObjectsManager()->setDefaultDrawOptions(mHistOrbitVsFEEmodules.get(), "COLZ");
+
+  setFillBuffers();
+}
+
+void DigitQcTask::setFillBuffers()
+{
+  mBufferAmp2Ch.setHistogram(mHistAmp2Ch.get());
+  mBufferTime2Ch.setHistogram(mHistTime2Ch.get());
+  mBufferEventDensity2Ch.setHistogram(mHistEventDensity2Ch.get());
+  mBufferChDataBits.setHistogram(mHistChDataBits.get());
+  mBufferOrbit2BC.setHistogram(mHistOrbit2BC.get());
+  mBufferBCvsTrg.setHistogram(mHistBCvsTrg.get());
+  mBufferOrbitVsTrg.setHistogram(mHistOrbitVsTrg.get());
+  mBufferBCvsFEEmodules.setHistogram(mHistBCvsFEEmodules.get());
+  mBufferOrbitVsFEEmodules.setHistogram(mHistOrbitVsFEEmodules.get());
+  mBufferBC.setHistogram(mHistBC.get());
+  mBufferChannelID.setHistogram(mHistChannelID.get());
+}
+
+void DigitQcTask::flushFillBuffers()
+{
+  mBufferAmp2Ch.flush();
+  mBufferTime2Ch.flush();
+  mBufferEventDensity2Ch.flush();
+  mBufferChDataBits.flush();
+  mBufferOrbit2BC.flush();
+  mBufferBCvsTrg.flush();
+  mBufferOrbitVsTrg.flush();
+  mBufferBCvsFEEmodules.flush();
+  mBufferOrbitVsFEEmodules.flush();
+  mBufferBC.flush();
+  mBufferChannelID.flush();
 }
 
 void DigitQcTask::startOfActivity(Activity& activity)
@@ -345,8 +378,10 @@ void DigitQcTask::monitorData(o2::framework::ProcessingContext& ctx)
         digit.mTriggers.getTimeC() == fit::Triggers::DEFAULT_TIME) {
       isTCM = false;
     }
-    mHistOrbit2BC->Fill(digit.getIntRecord().orbit % sOrbitsPerTF, digit.getIntRecord().bc);
-    mHistBC->Fill(digit.getIntRecord().bc);
+    const double bc = digit.getIntRecord().bc;
+    const double orbitInTF = digit.getIntRecord().orbit % sOrbitsPerTF;
+    mBufferOrbit2BC.fill(orbitInTF, bc);
+    mBufferBC.fill(bc);
 
     if (isTCM && !digit.mTriggers.getLaser()) {
       // mHistNchA->Fill(digit.mTriggers.nChanA); ak
@@ -363,8 +398,8 @@ void DigitQcTask::monitorData(o2::framework::ProcessingContext& ctx)
       }
 
       for (const auto& binPos : mHashedBitBinPos[digit.mTriggers.triggersignals]) {
-        mHistBCvsTrg->Fill(digit.getIntRecord().bc, binPos);
-        mHistOrbitVsTrg->Fill(digit.getIntRecord().orbit % sOrbitsPerTF, binPos);
+        mBufferBCvsTrg.fill(bc, binPos);
+        mBufferOrbitVsTrg.fill(orbitInTF, binPos);
       }
     }
 
@@ -378,22 +413,20 @@ void DigitQcTask::monitorData(o2::framework::ProcessingContext& ctx)
       }
     } // ak
 
-    std::set<uint8_t> setFEEmodules{};
+    mFEEmodulesInDigit.clear();
     for (const auto& chData : vecChData) {
       if (static_cast<int>(chData.mPMNumber) < 8)
         mPMChargeTotalCside += chData.mChargeADC;
       else
         mPMChargeTotalAside += chData.mChargeADC;
 
-      mHistTime2Ch->Fill(static_cast<Double_t>(ch_data::getTime(chData)),
-                         static_cast<Double_t>(ch_data::getChId(chData)));
-      mHistAmp2Ch->Fill(static_cast<Double_t>(ch_data::getChId(chData)),
-                        static_cast<Double_t>(ch_data::getCharge(chData)));
-      mHistEventDensity2Ch->Fill(static_cast<Double_t>(ch_data::getCharge(chData)),
-                                 static_cast<Double_t>(digit.getIntRecord().differenceInBC(
-                                   mStateLastIR2Ch[ch_data::getChId(chData)])));
+      const double chId = ch_data::getChId(chData);
+      mBufferTime2Ch.fill(ch_data::getTime(chData), chId);
+      mBufferAmp2Ch.fill(chId, ch_data::getCharge(chData));
+      mBufferEventDensity2Ch.fill(ch_data::getCharge(chData),
+                                  digit.getIntRecord().differenceInBC(mStateLastIR2Ch[ch_data::getChId(chData)]));
       mStateLastIR2Ch[ch_data::getChId(chData)] = digit.getIntRecord();
-      mHistChannelID->Fill(ch_data::getChId(chData));
+      mBufferChannelID.fill(chId);
 
       if (mSetAllowedChIDs.find(static_cast<unsigned int>(ch_data::getChId(chData))) != mSetAllowedChIDs.end()) {
         mMapHistAmp1D[ch_data::getChId(chData)]->Fill(ch_data::getCharge(chData));
@@ -457,26 +490,29 @@ void DigitQcTask::monitorData(o2::framework::ProcessingContext& ctx)
       }
       for (const auto& entry : mMapChTrgNames) {
         if ((ch_data::getPMbits(chData) & (1 << entry.first))) {
-          mHistChDataBits->Fill(ch_data::getChId(chData), entry.first);
+          mBufferChDataBits.fill(chId, entry.first);
         }
       }
 
-      setFEEmodules.insert(mChID2PMhash[static_cast<int>(chData.mPMNumber)]);
+      mFEEmodulesInDigit.push_back(mChID2PMhash[static_cast<int>(chData.mPMNumber)]);
     }
     /// PM charge is scaled by 8 to compare with TCM charge
     mPMChargeTotalAside = std::lround(static_cast<int>(mPMChargeTotalAside / 8));
     mPMChargeTotalCside = std::lround(static_cast<int>(mPMChargeTotalCside / 8));
 
     if (isTCM) {
-      setFEEmodules.insert(mTCMhash);
+      mFEEmodulesInDigit.push_back(mTCMhash);
       mHist2CorrTCMchAndPMch->Fill(digit.mTriggers.getAmplA() + digit.mTriggers.getAmplC(), (digit.mTriggers.getAmplA() + digit.mTriggers.getAmplC()) - (mPMChargeTotalAside + mPMChargeTotalCside));
       // std::cout<<"TCM ch "<<digit.mTriggers.getAmplA()+digit.mTriggers.getAmplC()<<" PM ch "<<mPMChargeTotalAside+mPMChargeTotalCside<<std::endl;
     }
-    for (const auto& feeHash : setFEEmodules) {
-      mHistBCvsFEEmodules->Fill(static_cast<double>(digit.getIntRecord().bc), static_cast<double>(feeHash));
-      mHistOrbitVsFEEmodules->Fill(static_cast<double>(digit.getIntRecord().orbit % sOrbitsPerTF), static_cast<double>(feeHash));
+    std::sort(mFEEmodulesInDigit.begin(), mFEEmodulesInDigit.end());
+    auto lastFEEmodule = std::unique(mFEEmodulesInDigit.begin(), mFEEmodulesInDigit.end());
+    for (auto feeHash = mFEEmodulesInDigit.begin(); feeHash != lastFEEmodule; ++feeHash) {
+      mBufferBCvsFEEmodules.fill(bc, *feeHash);
+      mBufferOrbitVsFEEmodules.fill(orbitInTF, *feeHash);
     }
   }
+  flushFillBuffers();
   mTimeSum += curTfTimeMax - curTfTimeMin;
 }
 
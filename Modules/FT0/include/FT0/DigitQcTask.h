@@ -34,6 +34,7 @@
 
 #include "QualityControl/TaskInterface.h"
 #include "QualityControl/QcInfoLogger.h"
+#include "Common/HistogramFillBuffer.h"
 
 #include "FT0Base/Constants.h"
 #include "DataFormatsFT0/Digit.h"
@@ -97,6 +98,8 @@ class DigitQcTask final : public TaskInterface
   }
 
   void rebinFromConfig();
+  void setFillBuffers();
+  void flushFillBuffers();
 
   TList* mListHistGarbage;
   std::set<unsigned int> mSetAllowedChIDs;
@@ -137,6 +140,22 @@ class DigitQcTask final : public TaskInterface
   std::unique_ptr<TH2F> mHistOrbitVsTrg;
   std::unique_ptr<TH2F> mHistOrbitVsFEEmodules;
 
+  // Entries of the histograms filled for each channel or each BC, given to the histograms with FillN at the end of each TF
+  common::HistogramFillBuffer2D mBufferAmp2Ch;
+  common::HistogramFillBuffer2D mBufferTime2Ch;
+  common::HistogramFillBuffer2D mBufferEventDensity2Ch;
+  common::HistogramFillBuffer2D mBufferChDataBits;
+  common::HistogramFillBuffer2D mBufferOrbit2BC;
+  common::HistogramFillBuffer2D mBufferBCvsTrg;
+  common::HistogramFillBuffer2D mBufferOrbitVsTrg;
+  common::HistogramFillBuffer2D mBufferBCvsFEEmodules;
+  common::HistogramFillBuffer2D mBufferOrbitVsFEEmodules;
+  common::HistogramFillBuffer1D mBufferBC;
+  common::HistogramFillBuffer1D mBufferChannelID;
+  common::HistogramFillBuffer1D mBufferNumADC;
+  common::HistogramFillBuffer1D mBufferNumCFD;
+  std::vector<uint8_t> mFEEmodulesInDigit; // FEE modules with data in the current digit
+
   // Hashed maps
   const std::array<std::vector<double>, 256> mHashedBitBinPos;                        // map with bit position for 1 byte trg signal, for 1 Dim hists;
   const std::array<std::vector<std::pair<double, double>>, 256> mHashedPairBitBinPos; // map with paired bit position for 1 byte trg signal, for 1 Dim hists;
@@ -16,6 +16,8 @@
 
 #include "FT0/DigitQcTask.h"
 
+#include <algorithm>
+
 #include "TCanvas.h"
 #include "TROOT.h"
 
@@ -249,6 +251,42 @@ void DigitQcTask::initialize(o2::framework::InitContext& /*ctx*/)
   getObjectsManager()->setDefaultDrawOptions(mHistTriggersCorrelation.get(), "COLZ");
   getObjectsManager()->startPublishing(mHistTimeSum2Diff.get());
   getObjectsManager()->setDefaultDrawOptions(mHistTimeSum2Diff.get(), "COLZ");
+
+  setFillBuffers();
+}
+
+void DigitQcTask::setFillBuffers()
+{
+  mBufferAmp2Ch.setHistogram(mHistAmp2Ch.get());
+  mBufferTime2Ch.setHistogram(mHistTime2Ch.get());
+  mBufferEventDensity2Ch.setHistogram(mHistEventDensity2Ch.get());
+  mBufferChDataBits.setHistogram(mHistChDataBits.get());
+  mBufferOrbit2BC.setHistogram(mHistOrbit2BC.get());
+  mBufferBCvsTrg.setHistogram(mHistBCvsTrg.get());
+  mBufferOrbitVsTrg.setHistogram(mHistOrbitVsTrg.get());
+  mBufferBCvsFEEmodules.setHistogram(mHistBCvsFEEmodules.get());
+  mBufferOrbitVsFEEmodules.setHistogram(mHistOrbitVsFEEmodules.get());
+  mBufferBC.setHistogram(mHistBC.get());
+  mBufferChannelID.setHistogram(mHistChannelID.get());
+  mBufferNumADC.setHistogram(mHistNumADC.get());
+  mBufferNumCFD.setHistogram(mHistNumCFD.get());
+}
+
+void DigitQcTask::flushFillBuffers()
+{
+  mBufferAmp2Ch.flush();
+  mBufferTime2Ch.flush();
+  mBufferEventDensity2Ch.flush();
+  mBufferChDataBits.flush();
+  mBufferOrbit2BC.flush();
+  mBufferBCvsTrg.flush();
+  mBufferOrbitVsTrg.flush();
+  mBufferBCvsFEEmodules.flush();
+  mBufferOrbitVsFEEmodules.flush();
+  mBufferBC.flush();
+  mBufferChannelID.flush();
+  mBufferNumADC.flush();
+  mBufferNumCFD.flush();
 }
 
 void DigitQcTask::startOfActivity(Activity& activity)
@@ -324,8 +362,10 @@ void DigitQcTask::monitorData(o2::framework::ProcessingContext& ctx)
     if (digit.mTriggers.timeA == -5000 && digit.mTriggers.timeC == -5000) {
       isTCM = false;
     }
-    mHistOrbit2BC->Fill(digit.getIntRecord().orbit % sOrbitsPerTF, digit.getIntRecord().bc);
-    mHistBC->Fill(digit.getBC());
+    const double bc = digit.getIntRecord().bc;
+    const double orbitInTF = digit.getIntRecord().orbit % sOrbitsPerTF;
+    mBufferOrbit2BC.fill(orbitInTF, bc);
+    mBufferBC.fill(bc);
     if (isTCM && !digit.mTriggers.getLaserBit()) {
       if (digit.mTriggers.nChanA > 0) {
         mHistNchA->Fill(digit.mTriggers.nChanA);
@@ -342,21 +382,22 @@ void DigitQcTask::monitorData(o2::framework::ProcessingContext& ctx)
         mHistTriggersCorrelation->Fill(binPos.first, binPos.second);
       }
       for (const auto& binPos : mHashedBitBinPos[digit.mTriggers.triggersignals]) {
-        mHistBCvsTrg->Fill(digit.getIntRecord().bc, binPos);
-        mHistOrbitVsTrg->Fill(digit.getIntRecord().orbit % sOrbitsPerTF, binPos);
+        mBufferBCvsTrg.fill(bc, binPos);
+        mBufferOrbitVsTrg.fill(orbitInTF, binPos);
       }
     }
-    std::set<uint8_t> setFEEmodules{};
+    mFEEmodulesInDigit.clear();
     for (const auto& chData : vecChData) {
-      mHistTime2Ch->Fill(static_cast<Double_t>(chData.ChId), static_cast<Double_t>(chData.CFDTime));
-      mHistAmp2Ch->Fill(static_cast<Double_t>(chData.ChId), static_cast<Double_t>(chData.QTCAmpl));
-      mHistEventDensity2Ch->Fill(static_cast<Double_t>(chData.ChId), static_cast<Double_t>(digit.mIntRecord.differenceInBC(mStateLastIR2Ch[chData.ChId])));
+      const double chId = chData.ChId;
+      mBufferTime2Ch.fill(chId, chData.CFDTime);
+      mBufferAmp2Ch.fill(chId, chData.QTCAmpl);
+      mBufferEventDensity2Ch.fill(chId, digit.mIntRecord.differenceInBC(mStateLastIR2Ch[chData.ChId]));
       mStateLastIR2Ch[chData.ChId] = digit.mIntRecord;
-      mHistChannelID->Fill(chData.ChId);
+      mBufferChannelID.fill(chId);
       if (chData.QTCAmpl > 0) {
-        mHistNumADC->Fill(chData.ChId);
+        mBufferNumADC.fill(chId);
       }
-      mHistNumCFD->Fill(chData.ChId);
+      mBufferNumCFD.fill(chId);
       if (mSetAllowedChIDs.size() != 0 && mSetAllowedChIDs.find(static_cast<unsigned int>(chData.ChId)) != mSetAllowedChIDs.end()) {
         mMapHistAmp1D[chData.ChId]->Fill(chData.QTCAmpl);
         mMapHistTime1D[chData.ChId]->Fill(chData.CFDTime);
@@ -368,19 +409,22 @@ void DigitQcTask::monitorData(o2::framework::ProcessingContext& ctx)
         }
       }
       for (const auto& binPos : mHashedBitBinPos[chData.ChainQTC]) {
-        mHistChDataBits->Fill(chData.ChId, binPos);
+        mBufferChDataBits.fill(chId, binPos);
       }
 
-      setFEEmodules.insert(mChID2PMhash[chData.ChId]);
+      mFEEmodulesInDigit.push_back(mChID2PMhash[chData.ChId]);
     }
     if (isTCM /* && (digit.getTriggers().triggersignals & (1 << o2::ft0::Triggers::bitDataIsValid))*/) {
-      setFEEmodules.insert(mTCMhash);
+      mFEEmodulesInDigit.push_back(mTCMhash);
     }
-    for (const auto& feeHash : setFEEmodules) {
-      mHistBCvsFEEmodules->Fill(static_cast<double>(digit.getIntRecord().bc), static_cast<double>(feeHash));
-      mHistOrbitVsFEEmodules->Fill(static_cast<double>(digit.getIntRecord().orbit % sOrbitsPerTF), static_cast<double>(feeHash));
+    std::sort(mFEEmodulesInDigit.begin(), mFEEmodulesInDigit.end());
+    auto lastFEEmodule = std::unique(mFEEmodulesInDigit.begin(), mFEEmodulesInDigit.end());
+    for (auto feeHash = mFEEmodulesInDigit.begin(); feeHash != lastFEEmodule; ++feeHash) {
+      mBufferBCvsFEEmodules.fill(bc, *feeHash);
+      mBufferOrbitVsFEEmodules.fill(orbitInTF, *feeHash);
     }
   }
+  flushFillBuffers();
 }
 
 void DigitQcTask::endOfCycle()
@@ -33,6 +33,7 @@
 
 #include "QualityControl/TaskInterface.h"
 #include "QualityControl/QcInfoLogger.h"
+#include "Common/HistogramFillBuffer.h"
 
 #include "FV0Base/Constants.h"
 #include "DataFormatsFV0/Digit.h"
@@ -98,6 +99,8 @@ class DigitQcTask final : public TaskInterface
   }
 
   void rebinFromConfig();
+  void setFillBuffers();
+  void flushFillBuffers();
 
   TList* mListHistGarbage;
   std::set<unsigned int> mSetAllowedChIDs;
@@ -138,6 +141,22 @@ class DigitQcTask final : public TaskInterface
   std::unique_ptr<TH2F> mHistOrbitVsTrg;
   std::unique_ptr<TH2F> mHistOrbitVsFEEmodules;
 
+  // Entries of the histograms filled for each channel or each BC, given to the histograms with FillN at the end of each TF
+  common::HistogramFillBuffer2D mBufferAmp2Ch;
+  common::HistogramFillBuffer2D mBufferTime2Ch;
+  common::HistogramFillBuffer2D mBufferEventDensity2Ch;
+  common::HistogramFillBuffer2D mBufferChDataBits;
+  common::HistogramFillBuffer2D mBufferOrbit2BC;
+  common::HistogramFillBuffer2D mBufferBCvsTrg;
+  common::HistogramFillBuffer2D mBufferOrbitVsTrg;
+  common::HistogramFillBuffer2D mBufferBCvsFEEmodules;
+  common::HistogramFillBuffer2D mBufferOrbitVsFEEmodules;
+  common::HistogramFillBuffer1D mBufferBC;
+  common::HistogramFillBuffer1D mBufferChannelID;
+  common::HistogramFillBuffer1D mBufferNumADC;
+  common::HistogramFillBuffer1D mBufferNumCFD;
+  std::vector<uint8_t> mFEEmodulesInDigit; // FEE modules with data in the current digit
+
   // Hashed maps
   static const size_t mapSize = 256;
   const std::array<std::vector<double>, mapSize> mHashedBitBinPos;                        // map with bit position for 1 byte trg signal, for 1 Dim hists;
@@ -57,6 +57,9 @@ class DataCompressionQcTask final : public TaskInterface
   void processMessage(const o2::ctf::CTFIOSize& ctfEncRep, const std::string detector);
 
  private:
+  /// draws the histograms of all active detectors to the canvases, once per cycle before they are published
+  void drawCanvases();
+
   bool mIsMergeable = false;                                                            // switch for canvas output: true->no canvas, false->canvas
   std::unordered_map<std::string, std::vector<std::unique_ptr<TH1>>> mCompressionHists; // contains two histograms for all active detector (as specified in the config)
   std::unique_ptr<TCanvas> mCompressionCanvas;                                          // displays the compression histograms for all active detectors
@@ -28,7 +28,10 @@ class TF1;
 class TProfile;
 class TEfficiency;
 
+#include <array>
+#include <cmath>
 #include <unordered_map>
+#include <vector>
 
 using namespace o2::quality_control::core;
 
@@ -55,6 +58,34 @@ class VertexingQcTask final : public TaskInterface
   void reset() override;
 
  private:
+  /// \brief Mean and variance of a distribution, updated with each value (Welford's algorithm)
+  struct RunningMoments {
+    uint64_t n = 0;
+    double mean = 0;
+    double m2 = 0;
+
+    void add(double value)
+    {
+      n++;
+      double delta = value - mean;
+      mean += delta / n;
+      m2 += delta * (value - mean);
+    }
+    double getRMS() const { return n > 1 ? std::sqrt(m2 / n) : 0; }
+    void reset() { *this = RunningMoments{}; }
+  };
+
+  /// \brief Multiplicity and vertex of an MC event, cached to avoid reading its header for each vertex
+  struct MCEventInfo {
+    int mult = 0;
+    std::array<double, 3> vertex{};
+  };
+
+  void fitVertexPositions();
+  void fitVertexPosition(TH1F* histo, TF1* function, const RunningMoments& moments);
+  void cacheMCEvents();
+  MCEventInfo getMCEventInfo(const o2::MCEventLabel& label);
+
   TH1F* mX = nullptr;                     // vertex X
   TF1* fX = nullptr;                      // fit vertex X
   TH1F* mY = nullptr;                     // vertex Y
@@ -65,10 +96,18 @@ class VertexingQcTask final : public TaskInterface
 
   bool mVerbose = false;
 
+  // the vertex positions are fitted every mFitCadence vertices (never if 0) and at the end of each cycle
+  uint64_t mFitCadence = 0;
+  uint64_t mVerticesSinceFit = 0;
+  RunningMoments mMomentsX; // moments of the vertex X distribution since the last reset
+  RunningMoments mMomentsY; // moments of the vertex Y distribution since the last reset
+
   // MC related part
   bool mUseMC = false;
   o2::steer::MCKinematicsReader mMCReader; // MC reader
   TProfile* mPurityVsMult = nullptr;       // purity vs multiplicity
+  std::vector<MCEventInfo> mMCEvents;      // cached info of the events of the underlying event source (0)
+  std::vector<double> mMCGenMult;          // multiplicities of all the events of source 0, as given to FillN
 
   std::unordered_map<o2::MCEventLabel, int> mMapEvIDSourceID; // unordered_map counting the number of vertices reconstructed per event and source (--> MCEventLabel)
   TH1F* mNPrimaryMCEvWithVtx = nullptr;                       // event multiplicity for MC events with at least 1 vertex
@@ -66,11 +66,17 @@ void VertexingQcTask::initialize(o2::framework::InitContext& /*ctx*/)
     }
   }
 
+  if (auto param = mCustomParameters.find("fitCadence"); param != mCustomParameters.end()) {
+    ILOG(Info, Devel) << "Custom parameter - fitCadence (n. vertices between fits, 0 = only at end of cycle): " << param->second << ENDM;
+    mFitCadence = std::stoull(param->second);
+  }
+
   if (auto param = mCustomParameters.find("isMC"); param != mCustomParameters.end()) {
     ILOG(Info, Devel) << "Custom parameter - isMC: " << param->second << ENDM;
     if (param->second == "true" || param->second == "True" || param->second == "TRUE") {
       mUseMC = true;
       mMCReader.initFromDigitContext("collisioncontext.root");
+      cacheMCEvents();
       mPurityVsMult = new TProfile("purityVsMult", "purityVsMult; MC primary mult; vtx purity", 10000, -0.5, 9999.5, 0.f, 1.f);
       mNPrimaryMCEvWithVtx = new TH1F("NPrimaryMCEvWithVtx", "NPrimaryMCEvWithVtx; MC primary mult; n. events", 10000, -0.5, 9999.5);
       mNPrimaryMCEvWithVtx->Sumw2();
@@ -171,8 +177,7 @@ void VertexingQcTask::monitorData(o2::framework::ProcessingContext& ctx)
       ILOG(Debug, Support) << "From source " << lbl.getSourceID() << ", event " << lbl.getEventID() << " has a vertex" << ENDM;
       mMapEvIDSourceID[{ lbl.getEventID(), lbl.getSourceID() }]++;
       if (mMapEvIDSourceID[{ lbl.getEventID(), lbl.getSourceID() }] == 1) { // filling numerator for efficiency
-        auto header = mMCReader.getMCEventHeader(lbl.getSourceID(), lbl.getEventID());
-        auto mult = header.GetNPrim();
+        auto mult = getMCEventInfo(lbl).mult;
         ILOG(Debug, Support) << "Found vertex for event with mult = " << mult << ENDM;
         mNPrimaryMCEvWithVtx->Fill(mult);
         // mRatioNPrimaryMCEvWithVtxvsNPrimaryMCGen = (TH1F *)mNPrimaryMCEvWithVtx->Clone(); //did not work
@@ -183,8 +188,7 @@ void VertexingQcTask::monitorData(o2::framework::ProcessingContext& ctx)
       if (lbl.getSourceID() != 0) { // using only underlying event,  which is source 0
         continue;
       }
-      auto header = mMCReader.getMCEventHeader(lbl.getSourceID(), lbl.getEventID());
-      auto mult = header.GetNPrim();
+      auto mult = getMCEventInfo(lbl).mult;
       auto nVertices = mMapEvIDSourceID[{ lbl.getEventID(), lbl.getSourceID() }];
       if (nVertices == 1) {
         ILOG(Debug, Support) << "Found " << nVertices << " vertex for event with mult = " << mult << ENDM;
@@ -194,11 +198,9 @@ void VertexingQcTask::monitorData(o2::framework::ProcessingContext& ctx)
       mCloneFactorVsMult->Fill(mult, nVertices);
     }
 
-    for (size_t i = 0; i < mMCReader.getNEvents(0); ++i) { // we use the underlying event, which is source 0
-      auto header = mMCReader.getMCEventHeader(0, i);      // we use the underlying event, which is source 0
-      auto mult = header.GetNPrim();
-      ILOG(Debug, Support) << "Found Gen event with mult = " << mult << ENDM;
-      mNPrimaryMCGen->Fill(mult);
+    // we use the underlying event, which is source 0, the multiplicities were cached in initialize()
+    if (!mMCGenMult.empty()) {
+      mNPrimaryMCGen->FillN(mMCGenMult.size(), mMCGenMult.data(), nullptr);
     }
     mRatioNPrimaryMCEvWithVtxvsNPrimaryMCGen->Divide(mNPrimaryMCGen);
   }
@@ -211,22 +213,29 @@ void VertexingQcTask::monitorData(o2::framework::ProcessingContext& ctx)
     auto timeUnc = pvertices[i].getTimeStamp().getTimeStampError();
     ILOG(Debug, Support) << "x = " << x << ", y = " << y << ", z = " << z << ", nContributors = " << nContr << ", timeUnc = " << timeUnc << ENDM;
     mX->Fill(x);
-    mX->Fit("fX", "Q", "", mX->GetMean() - mX->GetRMS(), mX->GetMean() + mX->GetRMS());
     mY->Fill(y);
-    mY->Fit("fY", "Q", "", mY->GetMean() - mY->GetRMS(), mY->GetMean() + mY->GetRMS());
+    // the moments follow the histogram statistics, which do not include the under- and overflows
+    if (x >= mX->GetXaxis()->GetXmin() && x < mX->GetXaxis()->GetXmax()) {
+      mMomentsX.add(x);
+    }
+    if (y >= mY->GetXaxis()->GetXmin() && y < mY->GetXaxis()->GetXmax()) {
+      mMomentsY.add(y);
+    }
+    if (mFitCadence > 0 && ++mVerticesSinceFit >= mFitCadence) {
+      fitVertexPositions();
+    }
     mZ->Fill(z);
     mNContributors->Fill(nContr);
     mTimeUncVsNContrib->Fill(nContr, timeUnc);
     mBeamSpot->Fill(x, y);
 
     if (mUseMC && mcLbl[i].isSet()) { // make sure the label was set
-      auto header = mMCReader.getMCEventHeader(mcLbl[i].getSourceID(), mcLbl[i].getEventID());
+      auto mcEvent = getMCEventInfo(mcLbl[i]);
       auto purity = mcLbl[i].getCorrWeight();
-      auto mult = header.GetNPrim();
+      auto mult = mcEvent.mult;
       ILOG(Debug, Support) << "purity = " << purity << ", mult = " << mult << ENDM;
       mPurityVsMult->Fill(mult, purity);
-      TVector3 vtMC;
-      header.GetVertex(vtMC);
+      const auto& vtMC = mcEvent.vertex;
       mVtxResXVsMult->Fill(mult, vtMC[0] - pvertices[i].getX());
       mVtxResYVsMult->Fill(mult, vtMC[1] - pvertices[i].getY());
       mVtxResZVsMult->Fill(mult, vtMC[2] - pvertices[i].getZ());
@@ -249,6 +258,11 @@ void VertexingQcTask::endOfCycle()
 {
   ILOG(Info, Support) << "endOfCycle" << ENDM;
 
+  fitVertexPositions();
+  if (mVerbose) {
+    ILOG(Info, Support) << "vertex X: mean = " << mMomentsX.mean << ", RMS = " << mMomentsX.getRMS() << ", vertex Y: mean = " << mMomentsY.mean << ", RMS = " << mMomentsY.getRMS() << ENDM;
+  }
+
   if (mUseMC) {
 
     if (!mVtxEffVsMult->SetTotalHistogram(*mNPrimaryMCGen, "f") ||
@@ -283,6 +297,9 @@ void VertexingQcTask::reset()
   mZ->Reset();
   mNContributors->Reset();
   mBeamSpot->Reset();
+  mMomentsX.reset();
+  mMomentsY.reset();
+  mVerticesSinceFit = 0;
   if (mUseMC) {
     mPurityVsMult->Reset();
     mNPrimaryMCEvWithVtx->Reset();
@@ -298,4 +315,49 @@ void VertexingQcTask::reset()
   }
 }
 
+void VertexingQcTask::fitVertexPositions()
+{
+  mVerticesSinceFit = 0;
+  fitVertexPosition(mX, fX, mMomentsX);
+  fitVertexPosition(mY, fY, mMomentsY);
+}
+
+void VertexingQcTask::fitVertexPosition(TH1F* histo, TF1* function, const RunningMoments& moments)
+{
+  double rms = moments.getRMS();
+  if (rms <= 0) {
+    return;
+  }
+  // starting from the running moments, Minuit converges in a few iterations
+  function->SetParameters(histo->GetMaximum(), moments.mean, rms);
+  histo->Fit(function, "Q", "", moments.mean - rms, moments.mean + rms);
+}
+
+void VertexingQcTask::cacheMCEvents()
+{
+  auto nEvents = mMCReader.getNEvents(0); // we use the underlying event, which is source 0
+  mMCEvents.resize(nEvents);
+  mMCGenMult.resize(nEvents);
+  for (size_t i = 0; i < nEvents; ++i) {
+    auto header = mMCReader.getMCEventHeader(0, i);
+    TVector3 vtMC;
+    header.GetVertex(vtMC);
+    mMCEvents[i].mult = header.GetNPrim();
+    mMCEvents[i].vertex = { vtMC[0], vtMC[1], vtMC[2] };
+    mMCGenMult[i] = mMCEvents[i].mult;
+  }
+  ILOG(Info, Support) << "Cached the multiplicity and vertex of " << nEvents << " MC events" << ENDM;
+}
+
+VertexingQcTask::MCEventInfo VertexingQcTask::getMCEventInfo(const o2::MCEventLabel& label)
+{
+  if (label.getSourceID() == 0 && static_cast<size_t>(label.getEventID()) < mMCEvents.size()) {
+    return mMCEvents[label.getEventID()];
+  }
+  auto header = mMCReader.getMCEventHeader(label.getSourceID(), label.getEventID());
+  TVector3 vtMC;
+  header.GetVertex(vtMC);
+  return { static_cast<int>(header.GetNPrim()), { vtMC[0], vtMC[1], vtMC[2] } };
+}
+
 } // namespace o2::quality_control_modules::glo
@@ -23,6 +23,9 @@
 #include "QualityControl/TaskInterface.h"
 #include "HMPIDReconstruction/HmpidDecoder2.h"
 
+#include <cstdint>
+#include <vector>
+
 class TH1F;
 class TH2F;
 class TProfile;
@@ -53,6 +56,29 @@ class HmpidTask final : public TaskInterface
 
  private:
   static const Int_t numCham = 7;
+  static constexpr Int_t numEquipments = 14;
+  static constexpr Int_t numColumns = 24;
+  static constexpr Int_t numDilogics = 10;
+  static constexpr Int_t numChannels = 48;
+  static constexpr Int_t numPads = numEquipments * numColumns * numDilogics * numChannels;
+
+  static constexpr Int_t padIndex(Int_t eqId, Int_t column, Int_t dilogic, Int_t channel)
+  {
+    return ((eqId * numColumns + column) * numDilogics + dilogic) * numChannels + channel;
+  }
+
+  /// \brief Position of a pad in the chambers, precomputed for each equipment, column, dilogic and channel
+  struct PadPosition {
+    int8_t module = -1;
+    uint8_t x = 0;
+    uint8_t y = 0;
+  };
+
+  void buildPadPositions();
+  void accumulatePads();
+  void resetPads();
+  void fillPedestalHistograms();
+
   TH1F* hPedestalMean = nullptr;
   TH1F* hPedestalSigma = nullptr;
   TProfile* hBusyTime = nullptr;
@@ -60,6 +86,13 @@ class HmpidTask final : public TaskInterface
   TProfile* hEventNumber = nullptr;
   TH2F* hModuleMap[numCham] = { nullptr };
   o2::hmpid::HmpidDecoder2* mDecoder = nullptr;
+
+  // pedestal accumulators, indexed by padIndex()
+  std::vector<PadPosition> mPadPositions;
+  std::vector<uint32_t> mPadSamples;
+  std::vector<double> mPadSum;
+  std::vector<double> mPadSquares;
+  std::vector<Int_t> mTouchedPads; // pads with at least one sample since the last reset
 };
 
 } // namespace o2::quality_control_modules::hmpid
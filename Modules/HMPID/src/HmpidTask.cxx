@@ -47,8 +47,6 @@ HmpidTask::~HmpidTask()
   }
 }
 
-Int_t NumCycles = 0;
-
 void HmpidTask::initialize(o2::framework::InitContext& /*ctx*/)
 {
   ILOG(Info, Support) << "initialize HmpidTask" << ENDM; // QcInfoLogger is used. FairMQ logs will go to there as well.
@@ -123,6 +121,9 @@ void HmpidTask::initialize(o2::framework::InitContext& /*ctx*/)
   getObjectsManager()->startPublishing(hEventSize);
 
   getObjectsManager()->startPublishing(hEventNumber);
+
+  buildPadPositions();
+  resetPads();
 }
 
 void HmpidTask::startOfActivity(Activity& /*activity*/)
@@ -137,6 +138,7 @@ void HmpidTask::startOfActivity(Activity& /*activity*/)
   for (Int_t i = 0; i < numCham; ++i) {
     hModuleMap[i]->Reset();
   }
+  resetPads();
 
   mDecoder = new o2::hmpid::HmpidDecoder2(14);
   mDecoder->init();
@@ -150,10 +152,8 @@ void HmpidTask::startOfCycle()
 
 void HmpidTask::monitorData(o2::framework::ProcessingContext& ctx)
 {
-  NumCycles++;
   mDecoder->init();
   mDecoder->setVerbosity(2); // this is for Debug
-                             //  static const Int_t numCham = 7;
 
   // for (auto&& input : ctx.inputs()) {
   for (auto&& input : o2::framework::InputRecordWalker(ctx.inputs())) {
@@ -170,7 +170,7 @@ void HmpidTask::monitorData(o2::framework::ProcessingContext& ctx)
         break;
       }
 
-      for (Int_t eq = 0; eq < 14; eq++) {
+      for (Int_t eq = 0; eq < numEquipments; eq++) {
         int eqId = mDecoder->mTheEquipments[eq]->getEquipmentId();
         if (mDecoder->getAverageEventSize(eqId) > 0.) {
           hEventSize->Fill(eqId + 1, mDecoder->getAverageEventSize(eqId) / 1000.);
@@ -180,24 +180,6 @@ void HmpidTask::monitorData(o2::framework::ProcessingContext& ctx)
         }
 
         hEventNumber->Fill(eqId + 1, mDecoder->mTheEquipments[eq]->mEventNumber);
-
-        int module, x, y;
-
-        for (Int_t column = 0; column < 24; column++) {
-          for (Int_t dilogic = 0; dilogic < 10; dilogic++) {
-            for (Int_t channel = 0; channel < 48; channel++) {
-              Int_t n_samp = mDecoder->mTheEquipments[eq]->mPadSamples[column][dilogic][channel];
-              if (n_samp > 0) {
-                Float_t mean = mDecoder->getChannelSum(eqId, column, dilogic, channel) / n_samp;
-                Float_t sigma = TMath::Sqrt(mDecoder->getChannelSquare(eqId, column, dilogic, channel) / n_samp - mean * mean);
-                hPedestalMean->Fill(mean);
-                hPedestalSigma->Fill(sigma);
-                o2::hmpid::Digit::equipment2Absolute(eqId, column, dilogic, channel, &module, &x, &y);
-                hModuleMap[module]->Fill(x, y, mean);
-              }
-            }
-          }
-        }
       }
 
       /* Access the pads
@@ -214,16 +196,14 @@ void HmpidTask::monitorData(o2::framework::ProcessingContext& ctx)
     }
   }
 
-  if (NumCycles > 50) {
-    hPedestalMean->Reset();
-    hPedestalSigma->Reset();
-    NumCycles = 0;
-  }
+  // the decoder sums the pads over all the superpages of the TF, they are added once to the pedestal accumulators
+  accumulatePads();
 }
 
 void HmpidTask::endOfCycle()
 {
   ILOG(Info, Support) << "endOfCycle" << ENDM;
+  fillPedestalHistograms();
 }
 
 void HmpidTask::endOfActivity(Activity& /*activity*/)
@@ -244,6 +224,82 @@ void HmpidTask::reset()
   for (Int_t i = 0; i < numCham; ++i) {
     hModuleMap[i]->Reset();
   }
+  resetPads();
+}
+
+void HmpidTask::buildPadPositions()
+{
+  mPadPositions.assign(numPads, PadPosition{});
+  for (Int_t eqId = 0; eqId < numEquipments; eqId++) {
+    for (Int_t column = 0; column < numColumns; column++) {
+      for (Int_t dilogic = 0; dilogic < numDilogics; dilogic++) {
+        for (Int_t channel = 0; channel < numChannels; channel++) {
+          int module, x, y;
+          o2::hmpid::Digit::equipment2Absolute(eqId, column, dilogic, channel, &module, &x, &y);
+          auto& position = mPadPositions[padIndex(eqId, column, dilogic, channel)];
+          position.module = module;
+          position.x = x;
+          position.y = y;
+        }
+      }
+    }
+  }
+}
+
+void HmpidTask::resetPads()
+{
+  mPadSamples.assign(numPads, 0);
+  mPadSum.assign(numPads, 0.);
+  mPadSquares.assign(numPads, 0.);
+  mTouchedPads.clear();
+}
+
+void HmpidTask::accumulatePads()
+{
+  for (Int_t eq = 0; eq < numEquipments; eq++) {
+    int eqId = mDecoder->mTheEquipments[eq]->getEquipmentId();
+    if (eqId < 0 || eqId >= numEquipments) {
+      continue;
+    }
+    const auto& padSamples = mDecoder->mTheEquipments[eq]->mPadSamples;
+    for (Int_t column = 0; column < numColumns; column++) {
+      for (Int_t dilogic = 0; dilogic < numDilogics; dilogic++) {
+        for (Int_t channel = 0; channel < numChannels; channel++) {
+          Int_t n_samp = padSamples[column][dilogic][channel];
+          if (n_samp == 0) {
+            continue;
+          }
+          auto index = padIndex(eqId, column, dilogic, channel);
+          if (mPadSamples[index] == 0) {
+            mTouchedPads.push_back(index);
+          }
+          mPadSamples[index] += n_samp;
+          mPadSum[index] += mDecoder->getChannelSum(eqId, column, dilogic, channel);
+          mPadSquares[index] += mDecoder->getChannelSquare(eqId, column, dilogic, channel);
+        }
+      }
+    }
+  }
+}
+
+void HmpidTask::fillPedestalHistograms()
+{
+  hPedestalMean->Reset();
+  hPedestalSigma->Reset();
+  for (Int_t i = 0; i < numCham; ++i) {
+    hModuleMap[i]->Reset();
+  }
+
+  for (auto index : mTouchedPads) {
+    Double_t mean = mPadSum[index] / mPadSamples[index];
+    Double_t sigma = TMath::Sqrt(TMath::Max(0., mPadSquares[index] / mPadSamples[index] - mean * mean));
+    hPedestalMean->Fill(mean);
+    hPedestalSigma->Fill(sigma);
+    const auto& position = mPadPositions[index];
+    if (position.module >= 0 && position.module < numCham) {
+      hModuleMap[position.module]->Fill(position.x, position.y, mean);
+    }
+  }
 }
 
 } // namespace o2::quality_control_modules::hmpid
@@ -21,6 +21,7 @@
 #include "QualityControl/TaskInterface.h"
 #include <ITSMFTReconstruction/ChipMappingITS.h>
 #include <ITSMFTReconstruction/PixelData.h>
+#include <DataFormatsITSMFT/Digit.h>
 #include <ITSBase/GeometryTGeo.h>
 #include <ITSMFTReconstruction/RawPixelDecoder.h>
 
@@ -121,6 +122,8 @@ class ITSFhrTask final : public TaskInterface
   double** mChipPhi /* = new double*[NStaves[lay]]*/;       // IB/OB : mChipPhi[Stave][chip]
   double** mChipEta /* = new double*[NStaves[lay]]*/;       // IB/OB : mChipEta[Stave][chip]
   int** mChipStat /* = new double*[NStaves[lay]]*/;         // IB/OB : mChipStat[Stave][chip]
+  std::vector<std::vector<std::vector<o2::itsmft::Digit>>> mDigitsInStave; // IB : [stave][0]; OB : [stave][hic], cleared in each TF
+  std::vector<std::unique_ptr<TH1D>> mOccupancyPlotTmp;          // [stave], pixel occupancy of each stave in the TF
   int mNoisyPixelNumber[7][48] = { { 0 } };
 
   int mMaxGeneralAxisRange = -3;  // the range of TH2Poly plots z axis range, pow(10, mMinGeneralAxisRange) ~ pow(10, mMaxGeneralAxisRange)
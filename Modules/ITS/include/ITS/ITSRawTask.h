@@ -87,6 +87,7 @@ class ITSRawTask : public TaskInterface // todo add back the "final" when doxyge
   void formatAxes(TH1* h, const char* xTitle, const char* yTitle, float xOffset = 1., float yOffset = 1.);
   void formatPaveText(TPaveText* aPT, float aTextSize, Color_t aTextColor, short aTextAlign, const char* aText);
   void getHicCoordinates(int aLayer, int aChip, int aCol, int aRow, int& aHicRow, int& aHicCol);
+  void buildChipGeometry();
   void getProcessStatus(int aInfoFile, int& aFileFinish);
   void updateFile(int aRunID, int aEpID, int aFileID);
   void resetHitmaps();
@@ -145,6 +146,21 @@ class ITSRawTask : public TaskInterface // todo add back the "final" when doxyge
 
   o2::its::GeometryTGeo* gm = o2::its::GeometryTGeo::Instance();
 
+  /// \brief Position of a chip in the detector and in the hitmaps, to avoid geometry queries for each digit
+  struct ChipGeometry {
+    int layer = 0;
+    int stave = 0;
+    int hic = 0;
+    int chipHisto = 0; // index of the chip in hChipHitmap
+    int hicColOffset = 0;
+    int hicColSign = 1;
+    int hicRowOffset = 0;
+    int hicRowSign = 1;
+    double eta = 0.;
+    double phi = 0.;
+  };
+  std::vector<ChipGeometry> mChipGeometry;
+
   static constexpr int NError = 11;
   std::array<unsigned int, NError> mErrors;
   std::array<unsigned int, NError> mErrorPre;
@@ -176,8 +192,6 @@ class ITSRawTask : public TaskInterface // todo add back the "final" when doxyge
   int mTotalFileDone;
   //	int FileRest;
 
-  int mCounted;
-  int mTotalCounted = 10000;
   int mYellowed;
 };
 
@@ -22,6 +22,7 @@
 #include <TH2D.h>
 #include <ITSBase/GeometryTGeo.h>
 #include <TTree.h>
+#include <cstdint>
 
 class TH1D;
 class TH2D;
@@ -55,6 +56,38 @@ class ITSThresholdCalibrationTask : public TaskInterface
     bool isDeadColumn = false;
   };
 
+  /// \brief Binary record of the calibration result of one chip.
+  ///
+  /// The results can be sent either as text ("tunestring" and "chipdonestring" inputs, parsed with CalibrationParser)
+  /// or as contiguous arrays of CalibrationRecord in the native byte order, which are read in place
+  /// ("tunebinary" and "chipdonebinary" inputs, e.g. "tunebinary:ITS/TBIN;chipdonebinary:ITS/QCBIN;scantype:ITS/SCANT").
+  /// The binary inputs are used when present. The fields have the same meaning as in the text format:
+  ///  - layer, stave: "Lx_yy"
+  ///  - hs, hic, chipID, status: "Hs_pos", "Hic_Pos", "ChipID", "Status"
+  ///  - flags: bit 0 set if "Row" != -1 (dead pixel), bit 1 set if "Dcol" != -1 (dead column)
+  ///  - vcasn, rms, ithr, thr, noise, noiseRMS: "VCASN", "Rms", "ITHR", "THR", "Noise", "NoiseRms"
+  /// The fields which are not relevant for a scan type are ignored.
+  struct CalibrationRecord {
+    static constexpr uint8_t FlagDeadPixel = 0x1;
+    static constexpr uint8_t FlagDeadColumn = 0x2;
+
+    uint8_t layer;
+    uint8_t stave;
+    uint8_t hs;
+    uint8_t hic;
+    uint8_t chipID;
+    int8_t status;
+    uint8_t flags;
+    uint8_t reserved;
+    float vcasn;
+    float rms;
+    float ithr;
+    float thr;
+    float noise;
+    float noiseRMS;
+  };
+  static_assert(sizeof(CalibrationRecord) == 32, "the layout of CalibrationRecord is part of the input specification");
+
   void initialize(o2::framework::InitContext& ctx) override;
   void startOfActivity(Activity& activity) override;
   void startOfCycle() override;
@@ -74,6 +107,9 @@ class ITSThresholdCalibrationTask : public TaskInterface
   int getCurrentChip(int barrel, int chipid, int hic, int hs);
 
   CalibrationResStruct CalibrationParser(string input);
+  static CalibrationResStruct convertRecord(const CalibrationRecord& record);
+  void fillCalibrationResult(const CalibrationResStruct& result, char scanType, int iScan);
+  void fillChipDone(const CalibrationResStruct& result);
 
   std::vector<TObject*> mPublishedObjects;
 
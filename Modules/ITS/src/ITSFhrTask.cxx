@@ -231,6 +231,29 @@ void ITSFhrTask::initialize(o2::framework::InitContext& /*ctx*/)
         }
       }
     }
+
+    // the position of the chips does not change during the run
+    for (int ichip = ChipBoundary[mLayer]; ichip < ChipBoundary[mLayer + 1]; ichip++) {
+      int stave = 0, chip = 0;
+      auto glo = mGeom->getMatrixL2G(ichip)(loc);
+      if (mLayer < NLayerIB) {
+        stave = ichip / 9 - StaveBoundary[mLayer];
+        chip = ichip % 9;
+      } else {
+        stave = (ichip - ChipBoundary[mLayer]) / (14 * nHicPerStave[mLayer]);
+        chip = (ichip - ChipBoundary[mLayer]) % (14 * nHicPerStave[mLayer]);
+      }
+      mChipEta[stave][chip] = glo.eta();
+      mChipPhi[stave][chip] = glo.phi();
+    }
+
+    // buffers reused in each TF
+    mDigitsInStave.assign(NStaves[mLayer], std::vector<std::vector<Digit>>(nHicPerStave[mLayer]));
+    mOccupancyPlotTmp.clear();
+    for (int istave = 0; istave < NStaves[mLayer]; istave++) {
+      mOccupancyPlotTmp.emplace_back(new TH1D("", "", 300, -15, 0));
+      mOccupancyPlotTmp.back()->SetDirectory(nullptr);
+    }
   }
 }
 
@@ -418,35 +441,11 @@ void ITSFhrTask::monitorData(o2::framework::ProcessingContext& ctx)
   mDecoder->startNewTF(ctx.inputs());
   mDecoder->setDecodeNextAuto(true);
 
-  // define digit hit vector
-  std::vector<Digit>** digVec = new std::vector<Digit>*[NStaves[mLayer]]; // IB : digVec[stave][0]; OB : digVec[stave][hic]
-  const math_utils::Point3D<float> loc(0., 0., 0.);
-
-  if (mLayer < NLayerIB) {
-    for (int istave = 0; istave < NStaves[mLayer]; istave++) {
-      digVec[istave] = new std::vector<Digit>[nHicPerStave[mLayer]];
-    }
-  } else {
-    for (int istave = 0; istave < NStaves[mLayer]; istave++) {
-      digVec[istave] = new std::vector<Digit>[nHicPerStave[mLayer]];
-    }
-  }
-
-  // decode raw data and save digit hit to digit hit vector, and save hitnumber per chip/hic
-  // get the position of all chips in this layer
-  for (int ichip = ChipBoundary[mLayer]; ichip < ChipBoundary[mLayer + 1]; ichip++) {
-    int stave = 0, chip = 0;
-    auto glo = mGeom->getMatrixL2G(ichip)(loc);
-    if (mLayer < NLayerIB) {
-      stave = ichip / 9 - StaveBoundary[mLayer];
-      chip = ichip % 9;
-      mChipEta[stave][chip] = glo.eta();
-      mChipPhi[stave][chip] = glo.phi();
-    } else {
-      stave = (ichip - ChipBoundary[mLayer]) / (14 * nHicPerStave[mLayer]);
-      chip = (ichip - ChipBoundary[mLayer]) % (14 * nHicPerStave[mLayer]);
-      mChipEta[stave][chip] = glo.eta();
-      mChipPhi[stave][chip] = glo.phi();
+  // clear the digit hit vectors, keeping their memory for the next TF
+  auto& digVec = mDigitsInStave; // IB : digVec[stave][0]; OB : digVec[stave][hic]
+  for (auto& staveDigits : digVec) {
+    for (auto& hicDigits : staveDigits) {
+      hicDigits.clear();
     }
   }
 
@@ -529,10 +528,9 @@ void ITSFhrTask::monitorData(o2::framework::ProcessingContext& ctx)
   mErrorVsFeeid->Reset(); // Error is   statistic by decoder so if we didn't reset decoder, then we need reset Error plots, and use TH::SetBinContent function
   mOccupancyPlot->Reset();
 
-  // define tmp occupancy plot, which will use for multiple threads
-  TH1D** occupancyPlotTmp = new TH1D*[(int)activeStaves.size()];
-  for (int i = 0; i < (int)activeStaves.size(); i++) {
-    occupancyPlotTmp[i] = new TH1D("", "", 300, -15, 0);
+  // reset tmp occupancy plots, which are used by multiple threads
+  for (int istave : activeStaves) {
+    mOccupancyPlotTmp[istave]->Reset();
   }
 
   int totalhit = 0;
@@ -576,7 +574,7 @@ void ITSFhrTask::monitorData(o2::framework::ProcessingContext& ctx)
               mStaveHitmap[istave]->SetBinContent(pixelPos, (double)iter->second);
             }
             totalhit += (int)iter->second;
-            occupancyPlotTmp[i]->Fill(log10((double)iter->second / GBTLinkInfo->statistics.nTriggers));
+            mOccupancyPlotTmp[istave]->Fill(log10((double)iter->second / GBTLinkInfo->statistics.nTriggers));
           }
           mOccupancyLane[istave][ichip] = mHitnumberLane[istave][ichip] / (GBTLinkInfo->statistics.nTriggers * 1024. * 512.);
         }
@@ -607,7 +605,7 @@ void ITSFhrTask::monitorData(o2::framework::ProcessingContext& ctx)
                   mNoisyPixelNumber[mLayer][istave]++;
                 }
                 double pixelOccupancy = (double)iter->second;
-                occupancyPlotTmp[i]->Fill(log10(pixelOccupancy / GBTLinkInfo->statistics.nTriggers));
+                mOccupancyPlotTmp[istave]->Fill(log10(pixelOccupancy / GBTLinkInfo->statistics.nTriggers));
                 if (ichip < 7) {
                   int pixelPos[2] = { (ihic * ((nChipsPerHic[mLayer] / 2) * NCols)) + ichip * NCols + (int)(iter->first / 1000) + 1, NRows - ((int)iter->first % 1000) - 1 + (1024 * ilink) + 1 };
                   if ((double)GBTLinkInfo->statistics.nTriggers <= mCutTrgForSparse) {
@@ -642,7 +640,7 @@ void ITSFhrTask::monitorData(o2::framework::ProcessingContext& ctx)
   // fill Occupancy plots, chip stave occupancy plots and error statistic plots
   for (int i = 0; i < (int)activeStaves.size(); i++) {
     int istave = activeStaves[i];
-    mOccupancyPlot->Add(occupancyPlotTmp[i]);
+    mOccupancyPlot->Add(mOccupancyPlotTmp[istave].get());
     if (mLayer < NLayerIB) {
       for (int ichip = 0; ichip < nChipsPerHic[mLayer]; ichip++) {
         mChipStaveOccupancy->SetBinContent(ichip + 1, istave + 1, mOccupancyLane[istave][ichip]);
@@ -698,15 +696,6 @@ void ITSFhrTask::monitorData(o2::framework::ProcessingContext& ctx)
     mErrorPlots->SetBinContent(ierror + 1, feeError);
   }
 
-  // delete pointor in monitorData()
-  for (int istave = 0; istave < NStaves[mLayer]; istave++) {
-    delete[] digVec[istave];
-  }
-  delete[] digVec;
-  for (int i = 0; i < (int)activeStaves.size(); i++) {
-    delete occupancyPlotTmp[i];
-  }
-  delete[] occupancyPlotTmp;
   // temporarily reverting to get TFId by querying binding
   //   mTimeFrameId = ctx.inputs().get<int>("G");
   // Timer LOG
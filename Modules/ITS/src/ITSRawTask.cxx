@@ -23,15 +23,18 @@
 #include "ITS/ITSRawTask.h"
 #include "ITS/ITSTaskVariables.h"
 #include <Framework/InputRecord.h>
+#include <Monitoring/Monitoring.h>
 
 #include <TGaxis.h>
 #include <TStyle.h>
 #include <TPad.h>
+#include <chrono>
 using o2::itsmft::Digit;
 
 using namespace std;
 using namespace o2::itsmft;
 using namespace o2::its;
+using namespace o2::monitoring;
 
 namespace o2
 {
@@ -114,6 +117,7 @@ void ITSRawTask::initialize(o2::framework::InitContext& /*ctx*/)
   int numOfChips = geom->getNumberOfChips();
   ILOG(Info, Support) << "numOfChips = " << numOfChips << AliceO2::InfoLogger::InfoLogger::endm;
   setNChips(numOfChips);
+  buildChipGeometry();
 
   for (int i = 0; i < NError; i++) {
     pt[i] = new TPaveText(0.20, 0.80 - i * 0.05, 0.85, 0.85 - i * 0.05, "NDC");
@@ -163,7 +167,6 @@ void ITSRawTask::initialize(o2::framework::InitContext& /*ctx*/)
   bulb->SetFillColor(kRed);
   mTotalFileDone = 0;
   TotalHisTime = 0;
-  mCounted = 0;
   mYellowed = 0;
 }
 
@@ -179,19 +182,8 @@ void ITSRawTask::startOfCycle()
 
 void ITSRawTask::monitorData(o2::framework::ProcessingContext& ctx)
 {
-  double eta, phi;
-  int lay, sta, ssta, mod, chip;
   UShort_t col = 0, row = 0, ChipID = 0;
-  std::chrono::time_point<std::chrono::high_resolution_clock> start;
-  std::chrono::time_point<std::chrono::high_resolution_clock> startLoop;
-  std::chrono::time_point<std::chrono::high_resolution_clock> end;
-  int difference;
-
-  start = std::chrono::high_resolution_clock::now();
-
-  ofstream timefout("HisTimeGlobal.dat", ios::app);
-
-  ofstream timefout2("HisTimeLoop.dat", ios::app);
+  auto start = std::chrono::high_resolution_clock::now();
 
   ILOG(Info, Support) << "BEEN HERE BRO" << AliceO2::InfoLogger::InfoLogger::endm;
 
@@ -232,13 +224,9 @@ void ITSRawTask::monitorData(o2::framework::ProcessingContext& ctx)
     }
   }
 
-  difference = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-  //	ILOG(Info, Support) << "Before Loop = " << difference/1000.0 << "s" <<  AliceO2::InfoLogger::InfoLogger::endm;
-  timefout << "Before Loop  = " << difference / 1000.0 << "s" << std::endl;
+  auto startLoop = std::chrono::high_resolution_clock::now();
   int i = 0;
   for (auto&& pixeldata : digits) {
-    startLoop = std::chrono::high_resolution_clock::now();
-
     ChipID = pixeldata.getChipIndex();
     col = pixeldata.getColumn();
     row = pixeldata.getRow();
@@ -252,14 +240,6 @@ void ITSRawTask::monitorData(o2::framework::ProcessingContext& ctx)
       // cout << "Carried out, " << NEventPre << endl;
     }
 
-    // cout << "NFrame = " << NEvent  << endl;
-    if (mCounted < mTotalCounted) {
-      end = std::chrono::high_resolution_clock::now();
-      difference = std::chrono::duration_cast<std::chrono::nanoseconds>(end - startLoop).count();
-      //	ILOG(Info, Support) << "Before Geo = " << difference << "ns" <<  AliceO2::InfoLogger::InfoLogger::endm;
-      timefout2 << "Getting Value Time  = " << difference << "ns" << std::endl;
-    }
-
     if (mNEvent % 1000000 == 0 && mNEvent > 0) {
       ILOG(Info, Support) << "ChipID = " << ChipID << "  col = " << col << "  row = " << row << "  mNEvent = " << mNEvent << AliceO2::InfoLogger::InfoLogger::endm;
     }
@@ -269,68 +249,16 @@ void ITSRawTask::monitorData(o2::framework::ProcessingContext& ctx)
       ptNEvent->AddText(Form("Event Being Processed: %d", mNEvent));
     }
 
-    if (mCounted < mTotalCounted) {
-      end = std::chrono::high_resolution_clock::now();
-      difference = std::chrono::duration_cast<std::chrono::nanoseconds>(end - startLoop).count();
-      //	ILOG(Info, Support) << "Before Geo = " << difference << "ns" <<  AliceO2::InfoLogger::InfoLogger::endm;
-      timefout2 << "Before Geo  = " << difference << "ns" << std::endl;
-    }
-
-    gm->getChipId(ChipID, lay, sta, ssta, mod, chip);
-    // cout << "getID : " << ChipID << ", " << lay << ", " << sta << ", " << ssta << ", " << mod << ", " << chip << endl;
-    gm->fillMatrixCache(o2::math_utils::bit2Mask(o2::math_utils::TransformType::L2G));
-    const math_utils::Point3D<float> loc(0., 0., 0.);
-    auto glo = gm->getMatrixL2G(ChipID)(loc);
-
-    if (!mlayerEnable[lay]) {
+    const auto& chip = mChipGeometry[ChipID];
+    if (!mlayerEnable[chip.layer]) {
       continue;
     }
 
-    if (mCounted < mTotalCounted) {
-      end = std::chrono::high_resolution_clock::now();
-      difference = std::chrono::duration_cast<std::chrono::nanoseconds>(end - startLoop).count();
-      //	ILOG(Info, Support) << "After Geo = " << difference << "ns" <<  AliceO2::InfoLogger::InfoLogger::endm;
-      timefout2 << "After Geo =  " << difference << "ns" << std::endl;
-    }
-
-    int hicCol, hicRow;
-    // Todo: check if chipID is really chip ID
-    getHicCoordinates(lay, chip, col, row, hicRow, hicCol);
-    //  if (lay == 0 && sta == 0 && ssta == 0 && mod == 0 && chip == 0) cout << ChipID << ", " << col << ", " << row << endl;
-    hHicHitmap[lay][sta][mod]->Fill(hicCol, hicRow);
-    if (lay > NLayerIB && chip > 6) {
-      // OB HICs: take into account that chip IDs are 0 .. 6, 8 .. 14
-      hChipHitmap[lay][sta][mod][chip - 1]->Fill(col, row);
-    } else {
-      hChipHitmap[lay][sta][mod][chip]->Fill(col, row);
-      // hIBHitmap[lay]->Fill(hicCol, row+(sta*NRowHis));
-    }
-
-    if (mCounted < mTotalCounted) {
-      end = std::chrono::high_resolution_clock::now();
-      difference = std::chrono::duration_cast<std::chrono::nanoseconds>(end - startLoop).count();
-      //	ILOG(Info, Support) << "After Geo = " << difference << "ns" <<  AliceO2::InfoLogger::InfoLogger::endm;
-      timefout2 << "Fill HitMaps =  " << difference << "ns" << std::endl;
-    }
-
-    if (mCounted < mTotalCounted) {
-      end = std::chrono::high_resolution_clock::now();
-      difference = std::chrono::duration_cast<std::chrono::nanoseconds>(end - startLoop).count();
-      //	ILOG(Info, Support) << "After Geo = " << difference << "ns" <<  AliceO2::InfoLogger::InfoLogger::endm;
-      timefout2 << "Before glo etaphi =  " << difference << "ns" << std::endl;
-    }
-
-    eta = glo.eta();
-    phi = glo.phi();
-    hEtaPhiHitmap[lay]->Fill(eta, phi);
-
-    if (mCounted < mTotalCounted) {
-      end = std::chrono::high_resolution_clock::now();
-      difference = std::chrono::duration_cast<std::chrono::nanoseconds>(end - startLoop).count();
-      //	ILOG(Info, Support) << "After Geo = " << difference << "ns" <<  AliceO2::InfoLogger::InfoLogger::endm;
-      timefout2 << "After glo etaphi =  " << difference << "ns" << std::endl;
-      mCounted = mCounted + 1;
-    }
+    int hicCol = chip.hicColOffset + chip.hicColSign * col;
+    int hicRow = chip.hicRowOffset + chip.hicRowSign * row;
+    hHicHitmap[chip.layer][chip.stave][chip.hic]->Fill(hicCol, hicRow);
+    hChipHitmap[chip.layer][chip.stave][chip.hic][chip.chipHisto]->Fill(col, row);
+    hEtaPhiHitmap[chip.layer]->Fill(chip.eta, chip.phi);
 
     mNEventPre = mNEvent;
 
@@ -340,23 +268,30 @@ void ITSRawTask::monitorData(o2::framework::ProcessingContext& ctx)
     updateOccupancyPlots(mNEventPre);
   }
   //cout << "EndUpdateOcc " << NEventPre <<endl;
-  end = std::chrono::high_resolution_clock::now();
-  difference = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-  ILOG(Info, Support) << "Time After Loop = " << difference / 1000.0 << "s"
+  auto end = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double, std::milli> loopDuration = end - startLoop;
+  ILOG(Info, Support) << "Time After Loop = " << loopDuration.count() / 1000.0 << "s"
                       << AliceO2::InfoLogger::InfoLogger::endm;
-  timefout << "Time After Loop = " << difference / 1000.0 << "s" << std::endl;
 
   ILOG(Info, Support) << "NEventDone = " << mNEvent << AliceO2::InfoLogger::InfoLogger::endm;
   ILOG(Info, Support) << "Test  " << AliceO2::InfoLogger::InfoLogger::endm;
 
+  uint64_t nDigits = digits.size();
   digits.clear();
 
   end = std::chrono::high_resolution_clock::now();
-  difference = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-  TotalHisTime = TotalHisTime + difference;
-  ILOG(Info, Support) << "Time in Histogram = " << difference / 1000.0 << "s"
+  std::chrono::duration<double, std::milli> histogramDuration = end - start;
+  TotalHisTime = TotalHisTime + histogramDuration.count();
+  ILOG(Info, Support) << "Time in Histogram = " << histogramDuration.count() / 1000.0 << "s"
                       << AliceO2::InfoLogger::InfoLogger::endm;
-  timefout << "Time in Histogram = " << difference / 1000.0 << "s" << std::endl;
+
+  if (mMonitoring) {
+    mMonitoring->send(Metric{ "qc_its_raw_task_duration" }
+                        .addValue(std::chrono::duration<double, std::milli>(startLoop - start).count(), "before_loop_ms")
+                        .addValue(loopDuration.count(), "digits_loop_ms")
+                        .addValue(histogramDuration.count(), "monitor_data_ms")
+                        .addValue(nDigits, "digits"));
+  }
 
   if (mNEvent == 0 && ChipID == 0 && row == 0 && col == 0 && mYellowed == 0) {
     bulb->SetFillColor(kYellow);
@@ -364,6 +299,36 @@ void ITSRawTask::monitorData(o2::framework::ProcessingContext& ctx)
   }
 }
 
+void ITSRawTask::buildChipGeometry()
+{
+  int lay, sta, ssta, mod, chip;
+  const math_utils::Point3D<float> loc(0., 0., 0.);
+
+  mChipGeometry.resize(gm->getNumberOfChips());
+  for (int chipID = 0; chipID < gm->getNumberOfChips(); chipID++) {
+    auto& geometry = mChipGeometry[chipID];
+    gm->getChipId(chipID, lay, sta, ssta, mod, chip);
+    geometry.layer = lay;
+    geometry.stave = sta;
+    geometry.hic = mod;
+    // OB HICs: take into account that chip IDs are 0 .. 6, 8 .. 14
+    geometry.chipHisto = (lay > NLayerIB && chip > 6) ? chip - 1 : chip;
+
+    // Todo: check if chipID is really chip ID
+    int hicRow0, hicCol0, hicRow1, hicCol1;
+    getHicCoordinates(lay, chip, 0, 0, hicRow0, hicCol0);
+    getHicCoordinates(lay, chip, 1, 1, hicRow1, hicCol1);
+    geometry.hicColOffset = hicCol0;
+    geometry.hicColSign = hicCol1 - hicCol0;
+    geometry.hicRowOffset = hicRow0;
+    geometry.hicRowSign = hicRow1 - hicRow0;
+
+    auto glo = gm->getMatrixL2G(chipID)(loc);
+    geometry.eta = glo.eta();
+    geometry.phi = glo.phi();
+  }
+}
+
 void ITSRawTask::addObject(TObject* aObject, bool published)
 {
   if (!aObject) {
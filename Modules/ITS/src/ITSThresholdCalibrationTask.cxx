@@ -87,15 +87,9 @@ void ITSThresholdCalibrationTask::startOfCycle()
 void ITSThresholdCalibrationTask::monitorData(o2::framework::ProcessingContext& ctx)
 {
 
-  const auto tunString = ctx.inputs().get<gsl::span<char>>("tunestring");
-  const auto chipDoneString = ctx.inputs().get<gsl::span<char>>("chipdonestring");
   const auto scanType = ctx.inputs().get<char>("scantype");
 
-  string inString(tunString.begin(), tunString.end());
-  string inStringChipDone(chipDoneString.begin(), chipDoneString.end());
-
   Int_t iScan;
-  Double_t calibrationValue;
   if (scanType == 'V')
     iScan = 0;
   else if (scanType == 'I')
@@ -104,56 +98,39 @@ void ITSThresholdCalibrationTask::monitorData(o2::framework::ProcessingContext&
     iScan = 2;
   else if (scanType == 'A' || scanType == 'D')
     iScan = 3;
-  auto splitRes = splitString(inString, "Stave:");
-  auto splitResChipDone = splitString(inStringChipDone, "Stave:");
-
-  for (auto StaveStr : splitRes) {
-    if (StaveStr.size() > 0) {
-      CalibrationResStruct result = CalibrationParser(StaveStr);
-
-      int currentStave = StaveBoundary[result.Layer] + result.Stave + 1;
-      int iBarrel = getBarrel(result.Layer);
-      int currentChip = getCurrentChip(iBarrel, result.ChipID, result.HIC, result.Hs);
-
-      if (iScan < 3) {
-
-        if (scanType == 'V') {
-          calibrationValue = result.VCASN;
-        } else if (scanType == 'I') {
-          calibrationValue = result.ITHR;
-        } else if (scanType == 'T') {
-          calibrationValue = result.THR;
-          hCalibrationThrNoiseChipAverage[iBarrel]->SetBinContent(currentChip, currentStave, result.Noise);
-          hCalibrationThrNoiseRMSChipAverage[iBarrel]->Fill(currentChip, currentStave, result.NoiseRMS);
-        }
 
-        hCalibrationChipAverage[iScan][iBarrel]->SetBinContent(currentChip, currentStave, calibrationValue);
-        hCalibrationRMSChipAverage[iScan][iBarrel]->SetBinContent(currentChip, currentStave, result.RMS);
-      } else {
-        if (result.isDeadPixel)
-          hCalibrationDeadPixels[iBarrel]->Fill(currentChip, currentStave);
-        if (result.isDeadColumn)
-          hCalibrationDeadColumns[iBarrel]->Fill(currentChip, currentStave);
-      }
+  auto hasInput = [&inputs = ctx.inputs()](const char* binding) {
+    auto pos = inputs.getPos(binding);
+    return pos >= 0 && inputs.isValid(pos);
+  };
 
-      if (result.status == 1)
-        SuccessStatus[result.Layer]++;
-      TotalStatus[result.Layer]++;
+  if (hasInput("tunebinary")) {
+    // binary records are read in place, without copies nor parsing
+    for (const auto& record : ctx.inputs().get<gsl::span<CalibrationRecord>>("tunebinary")) {
+      fillCalibrationResult(convertRecord(record), scanType, iScan);
+    }
+  } else {
+    const auto tunString = ctx.inputs().get<gsl::span<char>>("tunestring");
+    string inString(tunString.begin(), tunString.end());
+    for (auto StaveStr : splitString(inString, "Stave:")) {
+      if (StaveStr.size() > 0) {
+        fillCalibrationResult(CalibrationParser(StaveStr), scanType, iScan);
+      }
     }
   }
 
   // Fill chips for which scan is completed
-  for (auto StaveStr : splitResChipDone) {
-    if (StaveStr.size() > 0) {
-      CalibrationResStruct result = CalibrationParser(StaveStr);
-
-      int currentStave = StaveBoundary[result.Layer] + result.Stave + 1;
-      int iBarrel = getBarrel(result.Layer);
-      int currentChip = getCurrentChip(iBarrel, result.ChipID, result.HIC, result.Hs);
-      if (hCalibrationChipDone[iBarrel]->GetBinContent(currentChip, currentStave) > 0) {
-        continue; // chip may appear >twice here
+  if (hasInput("chipdonebinary")) {
+    for (const auto& record : ctx.inputs().get<gsl::span<CalibrationRecord>>("chipdonebinary")) {
+      fillChipDone(convertRecord(record));
+    }
+  } else {
+    const auto chipDoneString = ctx.inputs().get<gsl::span<char>>("chipdonestring");
+    string inStringChipDone(chipDoneString.begin(), chipDoneString.end());
+    for (auto StaveStr : splitString(inStringChipDone, "Stave:")) {
+      if (StaveStr.size() > 0) {
+        fillChipDone(CalibrationParser(StaveStr));
       }
-      hCalibrationChipDone[iBarrel]->Fill(currentChip - 1, currentStave - 1);
     }
   }
 
@@ -190,6 +167,70 @@ void ITSThresholdCalibrationTask::monitorData(o2::framework::ProcessingContext&
   }
 }
 
+void ITSThresholdCalibrationTask::fillCalibrationResult(const CalibrationResStruct& result, char scanType, int iScan)
+{
+  Double_t calibrationValue;
+  int currentStave = StaveBoundary[result.Layer] + result.Stave + 1;
+  int iBarrel = getBarrel(result.Layer);
+  int currentChip = getCurrentChip(iBarrel, result.ChipID, result.HIC, result.Hs);
+
+  if (iScan < 3) {
+
+    if (scanType == 'V') {
+      calibrationValue = result.VCASN;
+    } else if (scanType == 'I') {
+      calibrationValue = result.ITHR;
+    } else if (scanType == 'T') {
+      calibrationValue = result.THR;
+      hCalibrationThrNoiseChipAverage[iBarrel]->SetBinContent(currentChip, currentStave, result.Noise);
+      hCalibrationThrNoiseRMSChipAverage[iBarrel]->Fill(currentChip, currentStave, result.NoiseRMS);
+    }
+
+    hCalibrationChipAverage[iScan][iBarrel]->SetBinContent(currentChip, currentStave, calibrationValue);
+    hCalibrationRMSChipAverage[iScan][iBarrel]->SetBinContent(currentChip, currentStave, result.RMS);
+  } else {
+    if (result.isDeadPixel)
+      hCalibrationDeadPixels[iBarrel]->Fill(currentChip, currentStave);
+    if (result.isDeadColumn)
+      hCalibrationDeadColumns[iBarrel]->Fill(currentChip, currentStave);
+  }
+
+  if (result.status == 1)
+    SuccessStatus[result.Layer]++;
+  TotalStatus[result.Layer]++;
+}
+
+void ITSThresholdCalibrationTask::fillChipDone(const CalibrationResStruct& result)
+{
+  int currentStave = StaveBoundary[result.Layer] + result.Stave + 1;
+  int iBarrel = getBarrel(result.Layer);
+  int currentChip = getCurrentChip(iBarrel, result.ChipID, result.HIC, result.Hs);
+  if (hCalibrationChipDone[iBarrel]->GetBinContent(currentChip, currentStave) > 0) {
+    return; // chip may appear >twice here
+  }
+  hCalibrationChipDone[iBarrel]->Fill(currentChip - 1, currentStave - 1);
+}
+
+ITSThresholdCalibrationTask::CalibrationResStruct ITSThresholdCalibrationTask::convertRecord(const CalibrationRecord& record)
+{
+  CalibrationResStruct result;
+  result.Layer = record.layer;
+  result.Stave = record.stave;
+  result.Hs = record.hs;
+  result.HIC = record.hic;
+  result.ChipID = record.chipID;
+  result.VCASN = record.vcasn;
+  result.RMS = record.rms;
+  result.ITHR = record.ithr;
+  result.THR = record.thr;
+  result.Noise = record.noise;
+  result.NoiseRMS = record.noiseRMS;
+  result.status = record.status;
+  result.isDeadPixel = record.flags & CalibrationRecord::FlagDeadPixel;
+  result.isDeadColumn = record.flags & CalibrationRecord::FlagDeadColumn;
+  return result;
+}
+
 int ITSThresholdCalibrationTask::getCurrentChip(int barrel, int chipid, int hic, int hs)
 {
   int currentChip;
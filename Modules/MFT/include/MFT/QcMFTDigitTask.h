@@ -101,6 +101,32 @@ class QcMFTDigitTask final : public TaskInterface
   int mZoneLadder[280] = { 0 };
   std::vector<std::unique_ptr<TH2F>> mDigitLadderDoubleColumnOccupancyMap;
 
+  // everything needed to fill the histograms of a chip, indexed by the chip index
+  struct ChipDescriptor {
+    int16_t ladder = 0;
+    int16_t positionInLadder = 0;
+    int16_t pixelMapIndex = -1; // index in mDigitPixelOccupancyMap, -1 if the chip is not from this FLP
+    int16_t chipMapIndex = -1;  // index in mDigitChipOccupancyMap, -1 if the chip is not from this FLP
+    int8_t summaryBinX = 0;
+    int8_t summaryBinY = 0;
+    float x = 0;
+    float y = 0;
+  };
+  ChipDescriptor mChipDescriptors[936];
+
+  // statistics of the pixel hit maps, which are filled bin by bin during noise scans
+  struct PixelMapStats {
+    int chipIndex = -1;
+    bool updated = false; // filled since the last call to updatePixelMapStats()
+    double entries = 0;
+    double sumX = 0;
+    double sumX2 = 0;
+    double sumY = 0;
+    double sumY2 = 0;
+    double sumXY = 0;
+  };
+  std::vector<PixelMapStats> mPixelMapStats;
+
   //  functions
   int getVectorIndexChipOccupancyMap(int chipIndex);
   int getIndexChipOccupancyMap(int vectorChipOccupancyMapIndex);
@@ -110,6 +136,8 @@ class QcMFTDigitTask final : public TaskInterface
   void getNameOfPixelOccupancyMap(TString& folderName, TString& histogramName, int iChipIndex);
   void resetArrays(int* array1, int* array2, int* array3);
   void getChipMapData();
+  void buildChipDescriptors();
+  void updatePixelMapStats();
 };
 
 } // namespace o2::quality_control_modules::mft
@@ -188,6 +188,8 @@ void QcMFTDigitTask::initialize(o2::framework::InitContext& /*ctx*/)
       getObjectsManager()->setDefaultDrawOptions(mDigitPixelOccupancyMap[iVectorIndex].get(), "colz");
     }
   }
+
+  buildChipDescriptors();
 }
 
 void QcMFTDigitTask::startOfActivity(Activity& /*activity*/)
@@ -224,39 +226,50 @@ void QcMFTDigitTask::monitorData(o2::framework::ProcessingContext& ctx)
   for (auto& oneDigit : digits) {
 
     int chipIndex = oneDigit.getChipIndex();
+    const auto& chip = mChipDescriptors[chipIndex];
 
     // fill ladder histogram
-    mDigitLadderDoubleColumnOccupancyMap[mChipLadder[chipIndex]]->Fill(oneDigit.getColumn() >> 1, mChipPositionInLadder[chipIndex]);
+    mDigitLadderDoubleColumnOccupancyMap[chip.ladder]->Fill(oneDigit.getColumn() >> 1, chip.positionInLadder);
 
-    int vectorIndex = getVectorIndexPixelOccupancyMap(chipIndex);
-    if (vectorIndex < 0) // if the chip is not from wanted FLP, the array will give -1
+    if (chip.pixelMapIndex < 0) // if the chip is not from wanted FLP, the index is -1
       continue;
 
     // fill info into the summary histo
-    int xBin = mDisk[chipIndex] * 2 + mFace[chipIndex];
-    int yBin = mZone[chipIndex] + mHalf[chipIndex] * 4;
-    mDigitOccupancySummary->Fill(xBin, yBin);
-
-    // fill pixel hit maps
-    if (mNoiseScan == 1)
-      mDigitPixelOccupancyMap[vectorIndex]->Fill(oneDigit.getColumn(), oneDigit.getRow());
+    mDigitOccupancySummary->Fill(chip.summaryBinX, chip.summaryBinY);
+
+    // fill pixel hit maps, directly in their bins, their statistics are updated at the end of the cycle
+    if (mNoiseScan == 1) {
+      int column = oneDigit.getColumn();
+      int row = oneDigit.getRow();
+      auto& pixelMap = mDigitPixelOccupancyMap[chip.pixelMapIndex];
+      int bin = pixelMap->GetBin(column / binWidthPixelOccupancyMap + 1, row / binWidthPixelOccupancyMap + 1);
+      pixelMap->GetArray()[bin]++;
+      auto& stats = mPixelMapStats[chip.pixelMapIndex];
+      stats.updated = true;
+      stats.entries++;
+      stats.sumX += column;
+      stats.sumX2 += column * column;
+      stats.sumY += row;
+      stats.sumY2 += row * row;
+      stats.sumXY += column * row;
+    }
 
     // fill overview histograms
     mDigitChipOccupancy->Fill(chipIndex);
-    if (mNoiseScan == 1)
-      mDigitChipStdDev->SetBinContent(chipIndex + 1, mDigitPixelOccupancyMap[vectorIndex]->GetStdDev(1));
 
     // fill integrated chip hit maps
-    int vectorOccupancyMapIndex = getVectorIndexChipOccupancyMap(chipIndex);
-    if (vectorOccupancyMapIndex < 0)
+    if (chip.chipMapIndex < 0)
       continue;
-    mDigitChipOccupancyMap[vectorOccupancyMapIndex]->Fill(mX[chipIndex], mY[chipIndex]);
+    mDigitChipOccupancyMap[chip.chipMapIndex]->Fill(chip.x, chip.y);
   }
 }
 
 void QcMFTDigitTask::endOfCycle()
 {
   ILOG(Info, Support) << "endOfCycle" << ENDM;
+
+  if (mNoiseScan == 1)
+    updatePixelMapStats();
 }
 
 void QcMFTDigitTask::endOfActivity(Activity& /*activity*/)
@@ -289,6 +302,7 @@ void QcMFTDigitTask::reset()
     int maxVectorIndex = mNumberOfPixelMapsPerFLP[mCurrentFLP] + mNumberOfPixelMapsPerFLP[4 - mCurrentFLP];
     for (int iVectorIndex = 0; iVectorIndex < maxVectorIndex; iVectorIndex++) {
       mDigitPixelOccupancyMap[iVectorIndex]->Reset();
+      mPixelMapStats[iVectorIndex] = PixelMapStats{ mPixelMapStats[iVectorIndex].chipIndex };
     }
   }
 }
@@ -405,6 +419,44 @@ int QcMFTDigitTask::getChipIndexPixelOccupancyMap(int vectorIndex)
   return chipIndex;
 }
 
+void QcMFTDigitTask::buildChipDescriptors()
+{
+  for (int iChip = 0; iChip < numberOfChips; iChip++) {
+    auto& chip = mChipDescriptors[iChip];
+    chip.ladder = mChipLadder[iChip];
+    chip.positionInLadder = mChipPositionInLadder[iChip];
+    chip.pixelMapIndex = getVectorIndexPixelOccupancyMap(iChip);
+    chip.chipMapIndex = mOccupancyMapIndexOfChips[iChip] < 0 ? -1 : getVectorIndexChipOccupancyMap(iChip);
+    chip.summaryBinX = mDisk[iChip] * 2 + mFace[iChip];
+    chip.summaryBinY = mZone[iChip] + mHalf[iChip] * 4;
+    chip.x = mX[iChip];
+    chip.y = mY[iChip];
+  }
+
+  mPixelMapStats.assign(mDigitPixelOccupancyMap.size(), PixelMapStats{});
+  for (int iChip = 0; iChip < numberOfChips; iChip++) {
+    if (mChipDescriptors[iChip].pixelMapIndex >= 0 && mChipDescriptors[iChip].pixelMapIndex < int(mPixelMapStats.size()))
+      mPixelMapStats[mChipDescriptors[iChip].pixelMapIndex].chipIndex = iChip;
+  }
+}
+
+void QcMFTDigitTask::updatePixelMapStats()
+{
+  for (size_t iVectorIndex = 0; iVectorIndex < mPixelMapStats.size(); iVectorIndex++) {
+    auto& stats = mPixelMapStats[iVectorIndex];
+    if (!stats.updated)
+      continue;
+    stats.updated = false;
+
+    // same statistics as if the maps had been filled with Fill(column, row)
+    Double_t histoStats[7] = { stats.entries, stats.entries, stats.sumX, stats.sumX2, stats.sumY, stats.sumY2, stats.sumXY };
+    auto& pixelMap = mDigitPixelOccupancyMap[iVectorIndex];
+    pixelMap->PutStats(histoStats);
+    pixelMap->SetEntries(stats.entries);
+    mDigitChipStdDev->SetBinContent(stats.chipIndex + 1, pixelMap->GetStdDev(1));
+  }
+}
+
 void QcMFTDigitTask::resetArrays(int* array1, int* array2, int* array3)
 {
 
@@ -5,5 +5,7 @@
 
 #pragma link C++ class o2::quality_control_modules::muon::MergeableTH1Ratio + ;
 #pragma link C++ class o2::quality_control_modules::muon::MergeableTH2Ratio + ;
+#pragma link C++ class o2::quality_control_modules::muon::MergeableTH1RatioLazy - ;
+#pragma link C++ class o2::quality_control_modules::muon::MergeableTH2RatioLazy - ;
 
 #endif
@@ -58,7 +58,7 @@ class MergeableTH1Ratio : public TH1F, public o2::mergers::MergeInterface
     return mScalingFactor;
   }
 
-  void update();
+  virtual void update();
 
  private:
   TH1D* mHistoNum{ nullptr };
@@ -58,7 +58,7 @@ class MergeableTH2Ratio : public TH2F, public o2::mergers::MergeInterface
     return mShowZeroBins;
   }
 
-  void update();
+  virtual void update();
 
   void beautify();
 
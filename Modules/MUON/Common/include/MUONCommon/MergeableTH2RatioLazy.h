@@ -0,0 +1,87 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MergeableTH2RatioLazy.h
+/// \brief A MergeableTH2Ratio which ships only the numerator and denominator and computes the ratio on demand
+///
+
+#ifndef O2_MERGEABLETH2RATIOLAZY_H
+#define O2_MERGEABLETH2RATIOLAZY_H
+
+#include "MUONCommon/MergeableTH2Ratio.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace o2::quality_control_modules::muon
+{
+
+template <typename Lazy, typename Ratio>
+struct MergeableRatioLazy;
+
+/// \brief Variant of MergeableTH2Ratio which is cheaper to send through the mergers.
+///
+/// When sent to another process (e.g. from a task to a merger), only the numerator and denominator are serialized,
+/// optionally as a list of non-empty bins. The mergers only sum up the numerators and denominators, while the ratio
+/// is computed once, when its bins are first accessed (e.g. by a check or when drawn) or before storing the object
+/// in a file, such as the QCDB. The bins of the ratio can be read from several threads at the same time.
+class MergeableTH2RatioLazy : public MergeableTH2Ratio
+{
+ public:
+  MergeableTH2RatioLazy() = default;
+
+  MergeableTH2RatioLazy(MergeableTH2RatioLazy const& copymerge);
+
+  MergeableTH2RatioLazy(const char* name, const char* title, int nbinsx, double xmin, double xmax, int nbinsy, double ymin, double ymax, bool showZeroBins = false, bool sparse = false);
+
+  MergeableTH2RatioLazy(const char* name, const char* title, bool showZeroBins = false, bool sparse = false);
+
+  ~MergeableTH2RatioLazy() override = default;
+
+  void merge(MergeInterface* const other) override;
+
+  /// \brief Marks the ratio as outdated, to be called after the numerator or denominator have been modified.
+  /// The ratio is recomputed the next time its bins are accessed, or when the object is stored.
+  void update() override;
+
+  /// \brief Computes the ratio if the numerator or denominator changed since the last update
+  void updateIfNeeded() const;
+
+  /// \brief Selects whether the numerator and denominator are sent as a list of non-empty bins
+  void setSparse(bool sparse) { mSparse = sparse; }
+  bool isSparse() const { return mSparse; }
+
+  using TH2F::GetBinError;
+  Double_t GetBinError(Int_t bin) const override;
+
+ protected:
+  Double_t RetrieveBinContent(Int_t bin) const override;
+
+ private:
+  bool mSparse{ false };
+  std::vector<int> mSparseBins;
+  std::vector<double> mSparseNum;
+  std::vector<double> mSparseDen;
+  std::vector<double> mSparseNumSumw2;
+  std::vector<double> mSparseDenSumw2;
+  bool mSparseHasSumw2{ false };
+  mutable std::atomic<bool> mRatioUpToDate{ false }; //! the ratio is computed only when needed
+  mutable bool mRatioUpdating{ false };              //! set while the ratio is being computed
+  mutable std::recursive_mutex mRatioMutex;          //! serializes the computation of the ratio
+
+  friend struct MergeableRatioLazy<MergeableTH2RatioLazy, MergeableTH2Ratio>;
+
+  ClassDefOverride(MergeableTH2RatioLazy, 2);
+};
+
+} // namespace o2::quality_control_modules::muon
+
+#endif // O2_MERGEABLETH2RATIOLAZY_H
@@ -0,0 +1,115 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MergeableRatioLazy.h
+/// \brief Implementation shared by MergeableTH1RatioLazy and MergeableTH2RatioLazy
+
+#ifndef O2_MUON_MERGEABLERATIOLAZY_H
+#define O2_MUON_MERGEABLERATIOLAZY_H
+
+#include "RatioTransport.h"
+
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace o2::quality_control_modules::muon
+{
+
+/// \brief Implements the lazy ratio on top of the eager one, Ratio being MergeableTH1Ratio or MergeableTH2Ratio.
+///
+/// The ratio is computed under a lock, thus its bins can be read from several threads at the same time.
+/// Modifying the numerator or denominator while the ratio is read remains as unsafe as for any histogram.
+template <typename Lazy, typename Ratio>
+struct MergeableRatioLazy {
+  // TH1D or TH2F, whose bins are stored in the inherited TArrayD or TArrayF
+  using NumHisto = std::remove_pointer_t<decltype(std::declval<const Ratio&>().getNum())>;
+
+  static void merge(Lazy& self, o2::mergers::MergeInterface* const other)
+  {
+    // only the numerator and denominator are summed up, the ratio is computed when needed
+    self.getNum()->Add(dynamic_cast<const Ratio* const>(other)->getNum());
+    self.getDen()->Add(dynamic_cast<const Ratio* const>(other)->getDen());
+    update(self);
+  }
+
+  static void update(Lazy& self)
+  {
+    std::lock_guard<std::recursive_mutex> lock(self.mRatioMutex);
+    self.mRatioUpToDate.store(false, std::memory_order_release);
+  }
+
+  static void updateIfNeeded(const Lazy& self)
+  {
+    if (self.mRatioUpToDate.load(std::memory_order_acquire)) {
+      return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(self.mRatioMutex);
+    // Ratio::update() reads back the bins of the ratio (e.g. to compute its statistics), which brings us here again
+    if (self.mRatioUpToDate.load(std::memory_order_relaxed) || self.mRatioUpdating) {
+      return;
+    }
+    self.mRatioUpdating = true;
+    // the ratio bins are a cache of the numerator and denominator, they are computed in const getters
+    const_cast<Lazy&>(self).Ratio::update();
+    self.mRatioUpdating = false;
+    self.mRatioUpToDate.store(true, std::memory_order_release);
+  }
+
+  static void streamer(Lazy& self, TBuffer& b)
+  {
+    using namespace ratio_transport;
+    SparseBins sparseBins{ self.mSparseBins, self.mSparseNum, self.mSparseDen, self.mSparseNumSumw2, self.mSparseDenSumw2, self.mSparseHasSumw2 };
+
+    if (b.IsReading()) {
+      std::lock_guard<std::recursive_mutex> lock(self.mRatioMutex);
+      Lazy::Class()->ReadBuffer(b, &self);
+      if (self.mSparse && self.getNum()->GetSize() == 0) {
+        unpack(*self.getNum(), *self.getDen(), sparseBins);
+        sparseBins.clear();
+      }
+      // the ratio bins are not sent between processes, thus they have to be recomputed
+      const bool hasRatio = self.GetSize() != 0;
+      if (!hasRatio) {
+        self.SetBinsLength();
+      }
+      self.mRatioUpToDate.store(hasRatio, std::memory_order_release);
+      return;
+    }
+
+    if (!isTransport(b)) {
+      // the object is stored in a file, e.g. in the QCDB, thus we write a complete histogram
+      updateIfNeeded(self);
+      Lazy::Class()->WriteBuffer(b, &self);
+      return;
+    }
+
+    // the object is sent to another process, we skip the ratio and, if requested, the empty bins of numerator and denominator
+    DetachedArray<TArrayF> ratio(self);
+    DetachedArray<TArrayD> ratioSumw2(self.fSumw2);
+    std::optional<DetachedArray<NumHisto>> num, den;
+    std::optional<DetachedArray<TArrayD>> numSumw2, denSumw2;
+    if (self.mSparse) {
+      pack(*self.getNum(), *self.getDen(), sparseBins);
+      num.emplace(*self.getNum());
+      den.emplace(*self.getDen());
+      numSumw2.emplace(*self.getNum()->GetSumw2());
+      denSumw2.emplace(*self.getDen()->GetSumw2());
+    }
+    Lazy::Class()->WriteBuffer(b, &self);
+    sparseBins.clear();
+  }
+};
+
+} // namespace o2::quality_control_modules::muon
+
+#endif // O2_MUON_MERGEABLERATIOLAZY_H
@@ -0,0 +1,79 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MergeableTH1RatioLazy.cxx
+/// \brief A MergeableTH1Ratio which ships only the numerator and denominator and computes the ratio on demand
+///
+
+#include "MUONCommon/MergeableTH1RatioLazy.h"
+#include "MergeableRatioLazy.h"
+
+using namespace std;
+namespace o2::quality_control_modules::muon
+{
+
+using Impl = MergeableRatioLazy<MergeableTH1RatioLazy, MergeableTH1Ratio>;
+
+MergeableTH1RatioLazy::MergeableTH1RatioLazy(MergeableTH1RatioLazy const& copymerge)
+  : MergeableTH1Ratio(copymerge),
+    mSparse(copymerge.isSparse())
+{
+  update();
+}
+
+MergeableTH1RatioLazy::MergeableTH1RatioLazy(const char* name, const char* title, int nbinsx, double xmin, double xmax, double scaling, bool sparse)
+  : MergeableTH1Ratio(name, title, nbinsx, xmin, xmax, scaling),
+    mSparse(sparse),
+    mRatioUpToDate(true)
+{
+}
+
+MergeableTH1RatioLazy::MergeableTH1RatioLazy(const char* name, const char* title, double scaling, bool sparse)
+  : MergeableTH1Ratio(name, title, scaling),
+    mSparse(sparse),
+    mRatioUpToDate(true)
+{
+}
+
+void MergeableTH1RatioLazy::merge(MergeInterface* const other)
+{
+  Impl::merge(*this, other);
+}
+
+void MergeableTH1RatioLazy::update()
+{
+  // the ratio is recomputed only when its bins are accessed or when the object is stored
+  Impl::update(*this);
+}
+
+void MergeableTH1RatioLazy::updateIfNeeded() const
+{
+  Impl::updateIfNeeded(*this);
+}
+
+Double_t MergeableTH1RatioLazy::RetrieveBinContent(Int_t bin) const
+{
+  updateIfNeeded();
+  return MergeableTH1Ratio::RetrieveBinContent(bin);
+}
+
+Double_t MergeableTH1RatioLazy::GetBinError(Int_t bin) const
+{
+  updateIfNeeded();
+  return MergeableTH1Ratio::GetBinError(bin);
+}
+
+void MergeableTH1RatioLazy::Streamer(TBuffer& b)
+{
+  Impl::streamer(*this, b);
+}
+
+} // namespace o2::quality_control_modules::muon
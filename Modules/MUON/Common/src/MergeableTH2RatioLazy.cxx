@@ -0,0 +1,79 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file MergeableTH2RatioLazy.cxx
+/// \brief A MergeableTH2Ratio which ships only the numerator and denominator and computes the ratio on demand
+///
+
+#include "MUONCommon/MergeableTH2RatioLazy.h"
+#include "MergeableRatioLazy.h"
+
+using namespace std;
+namespace o2::quality_control_modules::muon
+{
+
+using Impl = MergeableRatioLazy<MergeableTH2RatioLazy, MergeableTH2Ratio>;
+
+MergeableTH2RatioLazy::MergeableTH2RatioLazy(MergeableTH2RatioLazy const& copymerge)
+  : MergeableTH2Ratio(copymerge),
+    mSparse(copymerge.isSparse())
+{
+  update();
+}
+
+MergeableTH2RatioLazy::MergeableTH2RatioLazy(const char* name, const char* title, int nbinsx, double xmin, double xmax, int nbinsy, double ymin, double ymax, bool showZeroBins, bool sparse)
+  : MergeableTH2Ratio(name, title, nbinsx, xmin, xmax, nbinsy, ymin, ymax, showZeroBins),
+    mSparse(sparse),
+    mRatioUpToDate(true)
+{
+}
+
+MergeableTH2RatioLazy::MergeableTH2RatioLazy(const char* name, const char* title, bool showZeroBins, bool sparse)
+  : MergeableTH2Ratio(name, title, showZeroBins),
+    mSparse(sparse),
+    mRatioUpToDate(true)
+{
+}
+
+void MergeableTH2RatioLazy::merge(MergeInterface* const other)
+{
+  Impl::merge(*this, other);
+}
+
+void MergeableTH2RatioLazy::update()
+{
+  // the ratio is recomputed only when its bins are accessed or when the object is stored
+  Impl::update(*this);
+}
+
+void MergeableTH2RatioLazy::updateIfNeeded() const
+{
+  Impl::updateIfNeeded(*this);
+}
+
+Double_t MergeableTH2RatioLazy::RetrieveBinContent(Int_t bin) const
+{
+  updateIfNeeded();
+  return MergeableTH2Ratio::RetrieveBinContent(bin);
+}
+
+Double_t MergeableTH2RatioLazy::GetBinError(Int_t bin) const
+{
+  updateIfNeeded();
+  return MergeableTH2Ratio::GetBinError(bin);
+}
+
+void MergeableTH2RatioLazy::Streamer(TBuffer& b)
+{
+  Impl::streamer(*this, b);
+}
+
+} // namespace o2::quality_control_modules::muon
@@ -0,0 +1,123 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file RatioTransport.h
+/// \brief Helpers to serialize the mergeable ratios without their redundant parts
+
+#ifndef O2_MUON_RATIOTRANSPORT_H
+#define O2_MUON_RATIOTRANSPORT_H
+
+#include <vector>
+#include <TBuffer.h>
+#include <TMessage.h>
+#include <TH1.h>
+
+namespace o2::quality_control_modules::muon::ratio_transport
+{
+
+/// \brief Detaches the content of a ROOT array for the lifetime of the object, so that it is not serialized.
+template <typename ArrayType>
+class DetachedArray
+{
+ public:
+  explicit DetachedArray(ArrayType& array) : mArray(array), mSize(array.fN), mData(array.fArray)
+  {
+    mArray.fN = 0;
+    mArray.fArray = nullptr;
+  }
+  ~DetachedArray()
+  {
+    mArray.fN = mSize;
+    mArray.fArray = mData;
+  }
+  DetachedArray(const DetachedArray&) = delete;
+  DetachedArray& operator=(const DetachedArray&) = delete;
+
+ private:
+  ArrayType& mArray;
+  Int_t mSize;
+  decltype(ArrayType::fArray) mData;
+};
+
+/// \brief Tells if the buffer is used to send an object to another process, as opposed to storing it in a file.
+inline bool isTransport(const TBuffer& buffer)
+{
+  return dynamic_cast<const TMessage*>(&buffer) != nullptr;
+}
+
+/// \brief Numerator and denominator bins with non-zero content, in a compact form. It refers to the vectors owned by a ratio.
+struct SparseBins {
+  std::vector<int>& bins;
+  std::vector<double>& num;
+  std::vector<double>& den;
+  std::vector<double>& numSumw2;
+  std::vector<double>& denSumw2;
+  bool& hasSumw2; ///< sent explicitly, since the Sumw2 vectors are also empty when all the bins are empty
+
+  void clear()
+  {
+    bins.clear();
+    num.clear();
+    den.clear();
+    numSumw2.clear();
+    denSumw2.clear();
+    hasSumw2 = false;
+  }
+};
+
+/// \brief Stores the bins which are non-empty either in the numerator or in the denominator.
+inline void pack(const TH1& hNum, const TH1& hDen, SparseBins sparse)
+{
+  sparse.clear();
+  sparse.hasSumw2 = hNum.GetSumw2N() > 0 && hDen.GetSumw2N() > 0;
+  for (int bin = 0; bin < hNum.GetNcells(); bin++) {
+    const double num = hNum.GetBinContent(bin);
+    const double den = hDen.GetBinContent(bin);
+    if (num == 0 && den == 0) {
+      continue;
+    }
+    sparse.bins.push_back(bin);
+    sparse.num.push_back(num);
+    sparse.den.push_back(den);
+    if (sparse.hasSumw2) {
+      sparse.numSumw2.push_back(hNum.GetSumw2()->At(bin));
+      sparse.denSumw2.push_back(hDen.GetSumw2()->At(bin));
+    }
+  }
+}
+
+/// \brief Restores the numerator and denominator bins, which arrays were detached before serialization.
+inline void unpack(TH1& hNum, TH1& hDen, const SparseBins& sparse)
+{
+  // SetBinContent increments the number of entries, which was already restored from the buffer
+  const double numEntries = hNum.GetEntries();
+  const double denEntries = hDen.GetEntries();
+  for (TH1* histo : { &hNum, &hDen }) {
+    histo->SetBinsLength();
+    if (sparse.hasSumw2) {
+      histo->GetSumw2()->Set(histo->GetNcells());
+    }
+  }
+  for (size_t i = 0; i < sparse.bins.size(); i++) {
+    hNum.SetBinContent(sparse.bins[i], sparse.num[i]);
+    hDen.SetBinContent(sparse.bins[i], sparse.den[i]);
+    if (sparse.hasSumw2) {
+      hNum.GetSumw2()->SetAt(sparse.numSumw2[i], sparse.bins[i]);
+      hDen.GetSumw2()->SetAt(sparse.denSumw2[i], sparse.bins[i]);
+    }
+  }
+  hNum.SetEntries(numEntries);
+  hDen.SetEntries(denEntries);
+}
+
+} // namespace o2::quality_control_modules::muon::ratio_transport
+
+#endif // O2_MUON_RATIOTRANSPORT_H
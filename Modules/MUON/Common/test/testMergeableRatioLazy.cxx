@@ -0,0 +1,171 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   testMergeableRatioLazy.cxx
+///
+
+#include "MUONCommon/MergeableTH1RatioLazy.h"
+#include "MUONCommon/MergeableTH2RatioLazy.h"
+
+#include <TBufferFile.h>
+#include <TMessage.h>
+#include <memory>
+
+#define BOOST_TEST_MODULE MergeableRatioLazy test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+using namespace o2::quality_control_modules::muon;
+
+namespace
+{
+
+// the constructor reading a received buffer is protected
+class ReceivedMessage : public TMessage
+{
+ public:
+  ReceivedMessage(void* buffer, Int_t size) : TMessage(buffer, size, false) {}
+};
+
+// sends the object through a TMessage, as between the tasks and the mergers
+template <typename T>
+std::unique_ptr<T> sendThroughMessage(const T& object)
+{
+  TMessage out(kMESS_OBJECT);
+  out.WriteObject(&object);
+  out.SetLength();
+  ReceivedMessage in(out.Buffer(), out.Length());
+  return std::unique_ptr<T>(static_cast<T*>(in.ReadObjectAny(T::Class())));
+}
+
+// stores the object as in a file, e.g. in the QCDB
+template <typename T>
+std::unique_ptr<T> storeInBufferFile(const T& object)
+{
+  TBufferFile out(TBuffer::kWrite);
+  out.WriteObjectAny(&object, T::Class());
+  TBufferFile in(TBuffer::kRead, out.Length(), out.Buffer(), false);
+  return std::unique_ptr<T>(static_cast<T*>(in.ReadObjectAny(T::Class())));
+}
+
+template <typename T>
+void checkSameNumDen(const T& sent, const T& received)
+{
+  for (auto [hSent, hReceived] : { std::make_pair(sent.getNum(), received.getNum()), std::make_pair(sent.getDen(), received.getDen()) }) {
+    BOOST_REQUIRE_EQUAL(hReceived->GetNcells(), hSent->GetNcells());
+    BOOST_CHECK_EQUAL(hReceived->GetEntries(), hSent->GetEntries());
+    BOOST_REQUIRE_EQUAL(hReceived->GetSumw2N(), hSent->GetSumw2N());
+    for (int bin = 0; bin < hSent->GetNcells(); bin++) {
+      BOOST_CHECK_EQUAL(hReceived->GetBinContent(bin), hSent->GetBinContent(bin));
+      if (hSent->GetSumw2N() > 0) {
+        BOOST_CHECK_EQUAL(hReceived->GetSumw2()->At(bin), hSent->GetSumw2()->At(bin));
+      }
+    }
+  }
+}
+
+template <typename T>
+void checkSameRatio(const T& expected, const T& actual)
+{
+  BOOST_REQUIRE_EQUAL(actual.GetNcells(), expected.GetNcells());
+  for (int bin = 0; bin < expected.GetNcells(); bin++) {
+    BOOST_CHECK_CLOSE(actual.GetBinContent(bin), expected.GetBinContent(bin), 1e-4);
+    BOOST_CHECK_CLOSE(actual.GetBinError(bin), expected.GetBinError(bin), 1e-4);
+  }
+}
+
+void fill(MergeableTH1RatioLazy& ratio, double x, double weight)
+{
+  ratio.getNum()->Fill(x, weight);
+  ratio.getDen()->Fill(x, 2 * weight);
+  ratio.getDen()->Fill(x + 2, weight);
+  ratio.update();
+}
+
+void fill(MergeableTH2RatioLazy& ratio, double x, double weight)
+{
+  ratio.getNum()->Fill(x, x, weight);
+  ratio.getDen()->Fill(x, x, 2 * weight);
+  ratio.getDen()->Fill(x + 2, x, weight);
+  ratio.update();
+}
+
+template <typename T, typename Transfer>
+void checkRoundTrip(T& sent, T& other, Transfer transfer)
+{
+  fill(sent, 1.5, 1.);
+  fill(sent, 3.5, 0.5);
+  fill(other, 1.5, 2.);
+  fill(other, 6.5, 1.);
+
+  auto received = transfer(sent);
+  BOOST_REQUIRE(received);
+  BOOST_CHECK_EQUAL(received->isSparse(), sent.isSparse());
+  checkSameNumDen(sent, *received);
+  checkSameRatio(sent, *received);
+
+  // the received object must be mergeable and its ratio up to date afterwards
+  auto receivedOther = transfer(other);
+  received->merge(receivedOther.get());
+  sent.merge(&other);
+  checkSameNumDen(sent, *received);
+  checkSameRatio(sent, *received);
+  BOOST_CHECK_CLOSE(received->GetBinContent(received->FindBin(1.5, 1.5)), (1. + 2.) / (2. + 4.), 1e-4);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(th1_ratio_round_trip)
+{
+  for (bool sparse : { false, true }) {
+    MergeableTH1RatioLazy sentMessage("ratio", "ratio", 10, 0, 10, 1., sparse);
+    MergeableTH1RatioLazy otherMessage("ratio", "ratio", 10, 0, 10, 1., sparse);
+    checkRoundTrip(sentMessage, otherMessage, [](const auto& object) { return sendThroughMessage(object); });
+
+    MergeableTH1RatioLazy sentFile("ratio", "ratio", 10, 0, 10, 1., sparse);
+    MergeableTH1RatioLazy otherFile("ratio", "ratio", 10, 0, 10, 1., sparse);
+    checkRoundTrip(sentFile, otherFile, [](const auto& object) { return storeInBufferFile(object); });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(th2_ratio_round_trip)
+{
+  for (bool sparse : { false, true }) {
+    MergeableTH2RatioLazy sentMessage("ratio", "ratio", 10, 0, 10, 10, 0, 10, false, sparse);
+    MergeableTH2RatioLazy otherMessage("ratio", "ratio", 10, 0, 10, 10, 0, 10, false, sparse);
+    checkRoundTrip(sentMessage, otherMessage, [](const auto& object) { return sendThroughMessage(object); });
+
+    MergeableTH2RatioLazy sentFile("ratio", "ratio", 10, 0, 10, 10, 0, 10, false, sparse);
+    MergeableTH2RatioLazy otherFile("ratio", "ratio", 10, 0, 10, 10, 0, 10, false, sparse);
+    checkRoundTrip(sentFile, otherFile, [](const auto& object) { return storeInBufferFile(object); });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(sparse_ratio_keeps_sumw2_when_empty)
+{
+  MergeableTH2RatioLazy sent("ratio", "ratio", 10, 0, 10, 10, 0, 10, false, true);
+  sent.getNum()->Sumw2();
+  sent.getDen()->Sumw2();
+
+  auto received = sendThroughMessage(sent);
+  BOOST_REQUIRE(received);
+  BOOST_CHECK_GT(received->getNum()->GetSumw2N(), 0);
+  BOOST_CHECK_GT(received->getDen()->GetSumw2N(), 0);
+  checkSameNumDen(sent, *received);
+
+  MergeableTH2RatioLazy withoutSumw2("ratio", "ratio", 10, 0, 10, 10, 0, 10, false, true);
+  auto receivedWithoutSumw2 = sendThroughMessage(withoutSumw2);
+  BOOST_REQUIRE(receivedWithoutSumw2);
+  BOOST_CHECK_EQUAL(receivedWithoutSumw2->getNum()->GetSumw2N(), 0);
+}
@@ -19,7 +19,9 @@
 #ifndef QC_MODULE_MUONCHAMBERS_GLOBALHISTOGRAM_H
 #define QC_MODULE_MUONCHAMBERS_GLOBALHISTOGRAM_H
 
+#include <array>
 #include <map>
+#include <vector>
 #include <TH2.h>
 
 namespace o2
@@ -94,6 +96,22 @@ class GlobalHistogram
   TH2F* getHist() { return mHist.first; }
 
  private:
+  /// \brief Correspondence between the bins of the global histogram and the bins of one cathode of a detection element.
+  /// Each destination bin is associated to the range [mSourceOffsets[i], mSourceOffsets[i+1]) of mSourceBins.
+  struct BinMap {
+    std::array<double, 6> mSourceBinning{}; // number of bins and limits of the X and Y axes of the source histogram
+    std::vector<int> mDestinationBins;      // global bin numbers in the global histogram
+    std::vector<int> mSourceOffsets;        // ranges of source bins, one more element than mDestinationBins
+    std::vector<int> mSourceBins;           // global bin numbers in the detector histogram
+  };
+
+  int getDEmin() const { return (mId == 0) ? 100 : 500; }
+  int getDEmax() const { return (mId == 0) ? 403 : 1100; }
+
+  void initBinMaps();
+  void buildBinMap(int de, int cathode, const TAxis& srcAxisX, const TAxis& srcAxisY, BinMap& binMap);
+  const BinMap& getBinMap(int de, int cathode, const TH2F* hist);
+  void getDeLimits(int de, float x0[2], float y0[2], float xMin[2], float xMax[2], float yMin[2], float yMax[2]);
   void initST345();
   void initST12();
   void getDeCenter(int de, float& xB0, float& yB0, float& xNB0, float& yNB0);
@@ -106,6 +124,7 @@ class GlobalHistogram
   TString mTitle;
   int mId;
   std::pair<TH2F*, bool> mHist;
+  std::vector<std::array<BinMap, 2>> mBinMaps; // bin maps of the bending and non-bending cathodes, indexed by getDEindex()
 };
 
 } // namespace muonchambers
@@ -27,6 +27,7 @@
 #include "MCHBase/Digit.h"
 #endif
 #include "MUONCommon/MergeableTH2Ratio.h"
+#include "MUONCommon/MergeableTH2RatioLazy.h"
 #include "MCH/GlobalHistogram.h"
 
 class TH1F;
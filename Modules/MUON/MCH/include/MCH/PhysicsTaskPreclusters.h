@@ -36,6 +36,7 @@
 #endif
 #include "MCHDigitFiltering/DigitFilter.h"
 #include "MCHBase/PreCluster.h"
+#include "MCHMappingInterface/Segmentation.h"
 
 using namespace o2::quality_control_modules::muon;
 
@@ -81,18 +82,45 @@ class PhysicsTaskPreclusters /*final*/ : public o2::quality_control::core::TaskI
     }
   }
 
-  bool plotPrecluster(const o2::mch::PreCluster& preCluster, gsl::span<const o2::mch::Digit> digits);
+  /// segmentation and histograms of a detection element, cached to avoid looking them up for each pre-cluster
+  struct DEHandles {
+    const o2::mch::mapping::Segmentation* segment{ nullptr };
+    TH1F* clusterCharge{ nullptr };
+    TH1F* clusterChargeOnCycle{ nullptr };
+    TH1F* clusterSize{ nullptr };
+    TH1F* clusterSizeB{ nullptr };
+    TH1F* clusterSizeNB{ nullptr };
+    DetectorHistogram* preclustersXY[4]{ nullptr, nullptr, nullptr, nullptr };
+  };
+
+  /// pre-clusters assigned to a worker, and the fills of the histograms shared by all the DEs,
+  /// which are buffered by the worker and applied at the end of the TF in the order of the workers
+  struct WorkerOutput {
+    std::vector<const o2::mch::PreCluster*> preClusters;
+    std::vector<std::pair<int, int>> elecNum; // (FEC ID, channel)
+    std::vector<std::pair<int, int>> elecDen;
+    std::vector<int> preclustersPerDE; // indexed by getDEindex()
+    std::vector<int> preclustersSignalPerDE;
+  };
+
+  void processPreclusters(WorkerOutput& output, gsl::span<const o2::mch::Digit> digits);
+  void mergeWorkerOutput(WorkerOutput& output);
+  bool plotPrecluster(const o2::mch::PreCluster& preCluster, gsl::span<const o2::mch::Digit> digits, WorkerOutput& output);
   void printPrecluster(gsl::span<const o2::mch::Digit> preClusterDigits);
   void printPreclusters(gsl::span<const o2::mch::PreCluster> preClusters, gsl::span<const o2::mch::Digit> digits);
 
   void computePseudoEfficiency();
-  bool getFecChannel(int deId, int padId, int& fecId, int& channel);
+  bool getFecChannel(const o2::mch::mapping::Segmentation& segment, int deId, int padId, int& fecId, int& channel);
 
   static constexpr int sMaxFeeId = 64;
   static constexpr int sMaxLinkId = 12;
   static constexpr int sMaxDsId = 40;
 
   bool mDiagnostic{ false };
+  size_t mNThreads{ 1 }; // number of threads processing the pre-clusters, the DEs are split among them
+
+  std::vector<DEHandles> mDEHandles; // indexed by getDEindex()
+  std::vector<WorkerOutput> mWorkerOutputs;
 
   o2::mch::raw::Elec2DetMapper mElec2DetMapper;
   o2::mch::raw::Det2ElecMapper mDet2ElecMapper;
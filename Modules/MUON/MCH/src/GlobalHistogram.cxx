@@ -271,6 +271,58 @@ static float getDetectorShiftY(int deId)
   return 0;
 }
 
+static float getDetectorHistXmin(int deId)
+{
+  if (deId < 500) {
+    if (getDetectorFlipX(deId)) {
+      return -1.0 * getDetectorHistWidth(deId);
+    } else {
+      return 0;
+    }
+  }
+
+  return -1.0 * getDetectorHistWidth(deId) / 2;
+}
+
+static float getDetectorHistXmax(int deId)
+{
+  if (deId < 500) {
+    if (getDetectorFlipX(deId)) {
+      return 0;
+    } else {
+      return getDetectorHistWidth(deId);
+    }
+  }
+
+  return getDetectorHistWidth(deId) / 2;
+}
+
+static float getDetectorHistYmin(int deId)
+{
+  if (deId < 500) {
+    if (getDetectorFlipY(deId)) {
+      return -1.0 * getDetectorHistHeight(deId);
+    } else {
+      return 0;
+    }
+  }
+
+  return -1.0 * getDetectorHistHeight(deId) / 2;
+}
+
+static float getDetectorHistYmax(int deId)
+{
+  if (deId < 500) {
+    if (getDetectorFlipY(deId)) {
+      return 0;
+    } else {
+      return getDetectorHistHeight(deId);
+    }
+  }
+
+  return getDetectorHistHeight(deId) / 2;
+}
+
 DetectorHistogram::DetectorHistogram(TString name, TString title, int deId, int cathode)
   : mName(name), mTitle(title), mDeId(deId), mCathode(cathode), mFlipX(getDetectorFlipX(deId)), mFlipY(getDetectorFlipY(deId)), mShiftX(getDetectorShiftX(deId)), mShiftY(getDetectorShiftY(deId))
 {
@@ -307,54 +359,22 @@ int DetectorHistogram::getNbinsY()
 
 float DetectorHistogram::getXmin()
 {
-  if (mDeId < 500) {
-    if (getDetectorFlipX(mDeId)) {
-      return -1.0 * getDetectorHistWidth(mDeId);
-    } else {
-      return 0;
-    }
-  }
-
-  return -1.0 * getDetectorHistWidth(mDeId) / 2;
+  return getDetectorHistXmin(mDeId);
 }
 
 float DetectorHistogram::getXmax()
 {
-  if (mDeId < 500) {
-    if (getDetectorFlipX(mDeId)) {
-      return 0;
-    } else {
-      return getDetectorHistWidth(mDeId);
-    }
-  }
-
-  return getDetectorHistWidth(mDeId) / 2;
+  return getDetectorHistXmax(mDeId);
 }
 
 float DetectorHistogram::getYmin()
 {
-  if (mDeId < 500) {
-    if (getDetectorFlipY(mDeId)) {
-      return -1.0 * getDetectorHistHeight(mDeId);
-    } else {
-      return 0;
-    }
-  }
-
-  return -1.0 * getDetectorHistHeight(mDeId) / 2;
+  return getDetectorHistYmin(mDeId);
 }
 
 float DetectorHistogram::getYmax()
 {
-  if (mDeId < 500) {
-    if (getDetectorFlipY(mDeId)) {
-      return 0;
-    } else {
-      return getDetectorHistHeight(mDeId);
-    }
-  }
-
-  return getDetectorHistHeight(mDeId) / 2;
+  return getDetectorHistYmax(mDeId);
 }
 
 void DetectorHistogram::init()
@@ -557,6 +577,26 @@ void GlobalHistogram::init()
       initST345();
       break;
   }
+
+  initBinMaps();
+}
+
+void GlobalHistogram::initBinMaps()
+{
+  mBinMaps.clear();
+  mBinMaps.resize(getDEindexMax() + 1);
+
+  auto buildMaps = [this](int de) {
+    if (de < getDEmin() || de > getDEmax()) {
+      return;
+    }
+    TAxis axisX(getDetectorHistXbins(de), getDetectorHistXmin(de), getDetectorHistXmax(de));
+    TAxis axisY(getDetectorHistYbins(de), getDetectorHistYmin(de), getDetectorHistYmax(de));
+    for (int cathode = 0; cathode < 2; cathode++) {
+      buildBinMap(de, cathode, axisX, axisY, mBinMaps[getDEindex(de)][cathode]);
+    }
+  };
+  o2::mch::mapping::forEachDetectionElement(buildMaps);
 }
 
 void GlobalHistogram::initST12()
@@ -988,14 +1028,136 @@ void GlobalHistogram::set_includeNull(std::map<int, std::shared_ptr<DetectorHist
   set(histB, histNB, true, true);
 }
 
-void GlobalHistogram::set(std::map<int, std::shared_ptr<DetectorHistogram>>& histB, std::map<int, std::shared_ptr<DetectorHistogram>>& histNB, bool doAverage, bool includeNullBins)
+void GlobalHistogram::getDeLimits(int de, float x0[2], float y0[2], float xMin[2], float xMax[2], float yMin[2], float yMax[2])
+{
+  float xB0, yB0, xNB0, yNB0;
+  getDeCenter(de, xB0, yB0, xNB0, yNB0);
+
+  x0[0] = xB0;
+  x0[1] = xNB0;
+  y0[0] = yB0;
+  y0[1] = yNB0;
+
+  const o2::mch::mapping::Segmentation& segment = o2::mch::mapping::segmentation(de);
+  const o2::mch::mapping::CathodeSegmentation& csegmentB = segment.bending();
+  o2::mch::contour::BBox<double> bboxB = o2::mch::mapping::getBBox(csegmentB);
+
+  const o2::mch::mapping::CathodeSegmentation& csegmentNB = segment.nonBending();
+  o2::mch::contour::BBox<double> bboxNB = o2::mch::mapping::getBBox(csegmentNB);
+
+  xMin[0] = static_cast<float>(xB0 - bboxB.width() / 2);
+  xMin[1] = static_cast<float>(xNB0 - bboxNB.width() / 2);
+  xMax[0] = static_cast<float>(xB0 + bboxB.width() / 2);
+  xMax[1] = static_cast<float>(xNB0 + bboxNB.width() / 2);
+  yMin[0] = static_cast<float>(yB0 + bboxB.ymin());
+  yMin[1] = static_cast<float>(yNB0 + bboxNB.ymin());
+  yMax[0] = static_cast<float>(yB0 + bboxB.ymax());
+  yMax[1] = static_cast<float>(yNB0 + bboxNB.ymax());
+
+  if (mId == 0) {
+    bool flipX = getDetectorFlipX(de);
+    bool flipY = getDetectorFlipY(de);
+    float shiftX = getDetectorShiftX(de);
+    float shiftY = getDetectorShiftY(de);
+    xMin[0] = flipX ? xB0 - 1.0 * (bboxB.width() + shiftX) : xB0 + shiftX;
+    xMin[1] = flipX ? xNB0 - 1.0 * (bboxNB.width() + shiftX) : xNB0 + shiftX;
+    xMax[0] = flipX ? xB0 - shiftX : (xB0 + bboxB.width() + shiftX);
+    xMax[1] = flipX ? xNB0 - shiftX : (xNB0 + bboxNB.width() + shiftX);
+
+    yMin[0] = flipY ? yB0 - 1.0 * (bboxB.height() + shiftY) : yB0 + shiftY;
+    yMin[1] = flipY ? yNB0 - 1.0 * (bboxNB.height() + shiftY) : yNB0 + shiftY;
+    yMax[0] = flipY ? yB0 - shiftY : (yB0 + bboxB.height() + shiftY);
+    yMax[1] = flipY ? yNB0 - shiftY : (yNB0 + bboxNB.height() + shiftY);
+  }
+}
+
+void GlobalHistogram::buildBinMap(int de, int cathode, const TAxis& srcAxisX, const TAxis& srcAxisY, BinMap& binMap)
 {
-  int deMin = (mId == 0) ? 100 : 500;
-  int deMax = (mId == 0) ? 403 : 1100;
+  binMap = BinMap{};
+  binMap.mSourceBinning = { static_cast<double>(srcAxisX.GetNbins()), srcAxisX.GetXmin(), srcAxisX.GetXmax(),
+                            static_cast<double>(srcAxisY.GetNbins()), srcAxisY.GetXmin(), srcAxisY.GetXmax() };
+  binMap.mSourceOffsets.push_back(0);
+
+  float x0[2], y0[2], xMin[2], xMax[2], yMin[2], yMax[2];
+  getDeLimits(de, x0, y0, xMin, xMax, yMin, yMax);
+
+  const TAxis* axisX = getHist()->GetXaxis();
+  const TAxis* axisY = getHist()->GetYaxis();
+  float binWidthX = axisX->GetBinWidth(1);
+  float binWidthY = axisY->GetBinWidth(1);
+  int srcNcellsX = srcAxisX.GetNbins() + 2;
+
+  // loop on destination bins
+  int binXmin = axisX->FindFixBin(xMin[cathode] + binWidthX / 2);
+  int binXmax = axisX->FindFixBin(xMax[cathode] - binWidthX / 2);
+  int binYmin = axisY->FindFixBin(yMin[cathode] + binWidthY / 2);
+  int binYmax = axisY->FindFixBin(yMax[cathode] - binWidthY / 2);
+
+  for (int by = binYmin; by <= binYmax; by++) {
+    // vertical boundaries of current bin, in DE coordinates
+    float minY = axisY->GetBinLowEdge(by) - y0[cathode];
+    float maxY = axisY->GetBinUpEdge(by) - y0[cathode];
+
+    // find Y bin range in source histogram
+    int srcBinYmin = srcAxisY.FindFixBin(minY);
+    if (srcAxisY.GetBinCenter(srcBinYmin) < minY) {
+      srcBinYmin += 1;
+    }
+    int srcBinYmax = srcAxisY.FindFixBin(maxY);
+    if (srcAxisY.GetBinCenter(srcBinYmax) > maxY) {
+      srcBinYmax -= 1;
+    }
+
+    for (int bx = binXmin; bx <= binXmax; bx++) {
+      // horizontal boundaries of current bin, in DE coordinates
+      float minX = axisX->GetBinLowEdge(bx) - x0[cathode];
+      float maxX = axisX->GetBinUpEdge(bx) - x0[cathode];
+
+      // find X bin range in source histogram
+      int srcBinXmin = srcAxisX.FindFixBin(minX);
+      if (srcAxisX.GetBinCenter(srcBinXmin) < minX) {
+        srcBinXmin += 1;
+      }
+      int srcBinXmax = srcAxisX.FindFixBin(maxX);
+      if (srcAxisX.GetBinCenter(srcBinXmax) > maxX) {
+        srcBinXmax -= 1;
+      }
+
+      binMap.mDestinationBins.push_back(getHist()->GetBin(bx, by));
+      for (int sby = srcBinYmin; sby <= srcBinYmax; sby++) {
+        for (int sbx = srcBinXmin; sbx <= srcBinXmax; sbx++) {
+          binMap.mSourceBins.push_back(sbx + srcNcellsX * sby);
+        }
+      }
+      binMap.mSourceOffsets.push_back(binMap.mSourceBins.size());
+    }
+  }
+}
+
+const GlobalHistogram::BinMap& GlobalHistogram::getBinMap(int de, int cathode, const TH2F* hist)
+{
+  if (mBinMaps.empty()) {
+    mBinMaps.resize(getDEindexMax() + 1);
+  }
+  auto& binMap = mBinMaps[getDEindex(de)][cathode];
+
+  // the maps are computed at initialization for the default binning of the detector histograms,
+  // they are only recomputed if the source histogram was created with a different binning
+  const TAxis* axisX = hist->GetXaxis();
+  const TAxis* axisY = hist->GetYaxis();
+  std::array<double, 6> binning{ static_cast<double>(axisX->GetNbins()), axisX->GetXmin(), axisX->GetXmax(),
+                                 static_cast<double>(axisY->GetNbins()), axisY->GetXmin(), axisY->GetXmax() };
+  if (binMap.mSourceOffsets.empty() || binMap.mSourceBinning != binning) {
+    buildBinMap(de, cathode, *axisX, *axisY, binMap);
+  }
+  return binMap;
+}
 
+void GlobalHistogram::set(std::map<int, std::shared_ptr<DetectorHistogram>>& histB, std::map<int, std::shared_ptr<DetectorHistogram>>& histNB, bool doAverage, bool includeNullBins)
+{
   for (auto& ih : histB) {
     int de = ih.first;
-    if (de < deMin || de > deMax) {
+    if (de < getDEmin() || de > getDEmax() || getDEindex(de) < 0 || getDEindex(de) > getDEindexMax()) {
       continue;
     }
 
@@ -1021,107 +1183,28 @@ void GlobalHistogram::set(std::map<int, std::shared_ptr<DetectorHistogram>>& his
 
     TH2F* hist[2] = { hB->getHist(), hNB->getHist() };
 
-    float xB0, yB0, xNB0, yNB0;
-    getDeCenter(de, xB0, yB0, xNB0, yNB0);
-
-    float x0[2] = { xB0, xNB0 };
-    float y0[2] = { yB0, yNB0 };
-
-    const o2::mch::mapping::Segmentation& segment = o2::mch::mapping::segmentation(de);
-    const o2::mch::mapping::CathodeSegmentation& csegmentB = segment.bending();
-    o2::mch::contour::BBox<double> bboxB = o2::mch::mapping::getBBox(csegmentB);
-    o2::mch::contour::Contour<double> envelopB = o2::mch::mapping::getEnvelop(csegmentB);
-
-    const o2::mch::mapping::CathodeSegmentation& csegmentNB = segment.nonBending();
-    o2::mch::contour::BBox<double> bboxNB = o2::mch::mapping::getBBox(csegmentNB);
-    o2::mch::contour::Contour<double> envelopNB = o2::mch::mapping::getEnvelop(csegmentNB);
-
-    float xMin[2] = { static_cast<float>(xB0 - bboxB.width() / 2), static_cast<float>(xNB0 - bboxNB.width() / 2) };
-    float xMax[2] = { static_cast<float>(xB0 + bboxB.width() / 2), static_cast<float>(xNB0 + bboxNB.width() / 2) };
-    float yMin[2] = { static_cast<float>(yB0 + bboxB.ymin()), static_cast<float>(yNB0 + bboxNB.ymin()) };
-    float yMax[2] = { static_cast<float>(yB0 + bboxB.ymax()), static_cast<float>(yNB0 + bboxNB.ymax()) };
-
-    if (mId == 0) {
-      bool flipX = getDetectorFlipX(de);
-      bool flipY = getDetectorFlipY(de);
-      float shiftX = getDetectorShiftX(de);
-      float shiftY = getDetectorShiftY(de);
-      xMin[0] = flipX ? xB0 - 1.0 * (bboxB.width() + shiftX) : xB0 + shiftX;
-      xMin[1] = flipX ? xNB0 - 1.0 * (bboxNB.width() + shiftX) : xNB0 + shiftX;
-      xMax[0] = flipX ? xB0 - shiftX : (xB0 + bboxB.width() + shiftX);
-      xMax[1] = flipX ? xNB0 - shiftX : (xNB0 + bboxNB.width() + shiftX);
-
-      yMin[0] = flipY ? yB0 - 1.0 * (bboxB.height() + shiftY) : yB0 + shiftY;
-      yMin[1] = flipY ? yNB0 - 1.0 * (bboxNB.height() + shiftY) : yNB0 + shiftY;
-      yMax[0] = flipY ? yB0 - shiftY : (yB0 + bboxB.height() + shiftY);
-      yMax[1] = flipY ? yNB0 - shiftY : (yNB0 + bboxNB.height() + shiftY);
-    }
-
-    float binWidthX = getHist()->GetXaxis()->GetBinWidth(1);
-    float binWidthY = getHist()->GetYaxis()->GetBinWidth(1);
-
     // loop on bending and non-bending planes
     for (int i = 0; i < 2; i++) {
-
-      if (hist[i] == nullptr) {
-        continue;
-      }
-
-      // loop on destination bins
-      int binXmin = getHist()->GetXaxis()->FindBin(xMin[i] + binWidthX / 2);
-      int binXmax = getHist()->GetXaxis()->FindBin(xMax[i] - binWidthX / 2);
-      int binYmin = getHist()->GetYaxis()->FindBin(yMin[i] + binWidthY / 2);
-      int binYmax = getHist()->GetYaxis()->FindBin(yMax[i] - binWidthY / 2);
-
-      for (int by = binYmin; by <= binYmax; by++) {
-        // vertical boundaries of current bin, in DE coordinates
-        float minY = getHist()->GetYaxis()->GetBinLowEdge(by) - y0[i];
-        float maxY = getHist()->GetYaxis()->GetBinUpEdge(by) - y0[i];
-
-        // find Y bin range in source histogram
-        int srcBinYmin = hist[i]->GetYaxis()->FindBin(minY);
-        if (hist[i]->GetYaxis()->GetBinCenter(srcBinYmin) < minY) {
-          srcBinYmin += 1;
-        }
-        int srcBinYmax = hist[i]->GetYaxis()->FindBin(maxY);
-        if (hist[i]->GetYaxis()->GetBinCenter(srcBinYmax) > maxY) {
-          srcBinYmax -= 1;
-        }
-
-        for (int bx = binXmin; bx <= binXmax; bx++) {
-          // horizontal boundaries of current bin, in DE coordinates
-          float minX = getHist()->GetXaxis()->GetBinLowEdge(bx) - x0[i];
-          float maxX = getHist()->GetXaxis()->GetBinUpEdge(bx) - x0[i];
-
-          // find X bin range in source histogram
-          int srcBinXmin = hist[i]->GetXaxis()->FindBin(minX);
-          if (hist[i]->GetXaxis()->GetBinCenter(srcBinXmin) < minX) {
-            srcBinXmin += 1;
-          }
-          int srcBinXmax = hist[i]->GetXaxis()->FindBin(maxX);
-          if (hist[i]->GetXaxis()->GetBinCenter(srcBinXmax) > maxX) {
-            srcBinXmax -= 1;
-          }
-
-          // loop on source bins, and compute the sum or average
-          int nBins = 0;
-          float tot = 0;
-          for (int sby = srcBinYmin; sby <= srcBinYmax; sby++) {
-            for (int sbx = srcBinXmin; sbx <= srcBinXmax; sbx++) {
-              float val = hist[i]->GetBinContent(sbx, sby);
-              if (val == 0 && !includeNullBins) {
-                continue;
-              }
-              nBins += 1;
-              tot += val;
-            }
+      const auto& binMap = getBinMap(de, i, hist[i]);
+      const float* srcContents = hist[i]->GetArray();
+
+      // loop on destination bins, and compute the sum or average of the corresponding source bins
+      for (size_t bin = 0; bin < binMap.mDestinationBins.size(); bin++) {
+        int nBins = 0;
+        float tot = 0;
+        for (int srcBin = binMap.mSourceOffsets[bin]; srcBin < binMap.mSourceOffsets[bin + 1]; srcBin++) {
+          float val = srcContents[binMap.mSourceBins[srcBin]];
+          if (val == 0 && !includeNullBins) {
+            continue;
           }
+          nBins += 1;
+          tot += val;
+        }
 
-          if (doAverage && (nBins > 0)) {
-            tot /= nBins;
-          }
-          getHist()->SetBinContent(bx, by, tot);
+        if (doAverage && (nBins > 0)) {
+          tot /= nBins;
         }
+        getHist()->SetBinContent(binMap.mDestinationBins[bin], tot);
       }
     }
   }
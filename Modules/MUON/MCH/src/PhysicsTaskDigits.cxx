@@ -76,7 +76,7 @@ void PhysicsTaskDigits::initialize(o2::framework::InitContext& /*ctx*/)
   }
 
   // Histograms in electronics coordinates
-  mHistogramOccupancyElec = std::make_shared<MergeableTH2Ratio>("Occupancy_Elec", "Occupancy", nElecXbins, 0, nElecXbins, 64, 0, 64);
+  mHistogramOccupancyElec = std::make_shared<MergeableTH2RatioLazy>("Occupancy_Elec", "Occupancy", nElecXbins, 0, nElecXbins, 64, 0, 64, false, true);
   publishObject(mHistogramOccupancyElec, "colz", false, false);
 
   mHistogramNHitsElec = mHistogramOccupancyElec->getNum();
@@ -135,8 +135,8 @@ void PhysicsTaskDigits::initialize(o2::framework::InitContext& /*ctx*/)
     mHistogramADCamplitudeDE.insert(make_pair(de, h));
     publishObject(h, "hist", false, true);
 
-    auto hm = std::make_shared<MergeableTH2Ratio>(TString::Format("Expert/%sOccupancy_B_XY_%03d", getHistoPath(de).c_str(), de),
-                                                  TString::Format("Occupancy XY (DE%03d B) (KHz)", de));
+    auto hm = std::make_shared<MergeableTH2RatioLazy>(TString::Format("Expert/%sOccupancy_B_XY_%03d", getHistoPath(de).c_str(), de),
+                                                      TString::Format("Occupancy XY (DE%03d B) (KHz)", de));
     mHistogramOccupancyDE[0].insert(make_pair(de, hm));
     publishObject(hm, "colz", false, true);
 
@@ -150,8 +150,8 @@ void PhysicsTaskDigits::initialize(o2::framework::InitContext& /*ctx*/)
     mHistogramNorbitsDE[0].insert(make_pair(de, h2d0));
     mAllHistograms.push_back(h2d0->getHist());
 
-    hm = std::make_shared<MergeableTH2Ratio>(TString::Format("Expert/%sOccupancy_NB_XY_%03d", getHistoPath(de).c_str(), de),
-                                             TString::Format("Occupancy XY (DE%03d NB) (KHz)", de));
+    hm = std::make_shared<MergeableTH2RatioLazy>(TString::Format("Expert/%sOccupancy_NB_XY_%03d", getHistoPath(de).c_str(), de),
+                                                 TString::Format("Occupancy XY (DE%03d NB) (KHz)", de));
     mHistogramOccupancyDE[1].insert(make_pair(de, hm));
     publishObject(hm, "colz", false, true);
 
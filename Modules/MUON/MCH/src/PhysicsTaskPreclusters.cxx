@@ -22,7 +22,9 @@
 #include <TF1.h>
 #include <TH2.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <algorithm>
+#include <future>
 
 #include "MCH/PhysicsTaskPreclusters.h"
 #ifdef MCH_HAS_MAPPING_FACTORY
@@ -63,6 +65,13 @@ void PhysicsTaskPreclusters::initialize(o2::framework::InitContext& /*ctx*/)
     }
   }
 
+  if (auto param = mCustomParameters.find("nThreads"); param != mCustomParameters.end()) {
+    mNThreads = std::max(1, std::stoi(param->second));
+  }
+  if (mNThreads > 1) {
+    ROOT::EnableThreadSafety();
+  }
+
   mElec2DetMapper = createElec2DetMapper<ElectronicMapperGenerated>();
   mDet2ElecMapper = createDet2ElecMapper<ElectronicMapperGenerated>();
   mFeeLink2SolarMapper = createFeeLink2SolarMapper<ElectronicMapperGenerated>();
@@ -170,6 +179,26 @@ void PhysicsTaskPreclusters::initialize(o2::framework::InitContext& /*ctx*/)
       mAllHistograms.push_back(hDenNB.get()->getHist());
     }
   }
+
+  mDEHandles.assign(getDEindexMax() + 1, DEHandles{});
+  for (auto de : o2::mch::raw::deIdsForAllMCH) {
+    auto& handles = mDEHandles[getDEindex(de)];
+    handles.segment = &o2::mch::mapping::segmentation(de);
+    handles.clusterCharge = mHistogramClchgDE[de].get();
+    handles.clusterChargeOnCycle = mHistogramClchgDEOnCycle[de].get();
+    handles.clusterSize = mHistogramClsizeDE[de].get();
+    handles.clusterSizeB = mHistogramClsizeDE_B[de].get();
+    handles.clusterSizeNB = mHistogramClsizeDE_NB[de].get();
+    for (int i = 0; i < 4; i++) {
+      handles.preclustersXY[i] = mHistogramPreclustersXY[i][de].get();
+    }
+  }
+
+  mWorkerOutputs.resize(mNThreads);
+  for (auto& output : mWorkerOutputs) {
+    output.preclustersPerDE.assign(getDEindexMax() + 1, 0);
+    output.preclustersSignalPerDE.assign(getDEindexMax() + 1, 0);
+  }
 }
 
 void PhysicsTaskPreclusters::startOfActivity(Activity& /*activity*/)
@@ -197,36 +226,95 @@ void PhysicsTaskPreclusters::monitorData(o2::framework::ProcessingContext& ctx)
   auto preClusters = ctx.inputs().get<gsl::span<o2::mch::PreCluster>>("preclusters");
   auto digits = ctx.inputs().get<gsl::span<o2::mch::Digit>>("preclusterdigits");
 
-  ILOG(Info, Support) << fmt::format("Received {} pre-clusters and {} digits", preClusters.size(), digits.size()) << AliceO2::InfoLogger::InfoLogger::endm;
+  ILOG(Debug, Devel) << fmt::format("Received {} pre-clusters and {} digits", preClusters.size(), digits.size()) << AliceO2::InfoLogger::InfoLogger::endm;
 
   updateTFcount(mHistogramPreclustersPerDE->getDen());
   updateTFcount(mHistogramPreclustersSignalPerDE->getDen());
 
-  bool print = true;
+  // the pre-clusters are split among the workers according to their DE, such that each of the per-DE histograms
+  // is only filled by one thread. Single-pad pre-clusters are not plotted, they are filtered out already here.
   for (auto& p : preClusters) {
-    if (!plotPrecluster(p, digits)) {
-      print = true;
+    if (p.nDigits < 2) {
+      continue;
+    }
+    int deIndex = getDEindex(digits[p.firstDigit].getDetID());
+    if (deIndex < 0 || deIndex >= static_cast<int>(mDEHandles.size()) || !mDEHandles[deIndex].segment) {
+      continue;
     }
+    mWorkerOutputs[deIndex % mWorkerOutputs.size()].preClusters.push_back(&p);
+  }
+
+  if (mWorkerOutputs.size() == 1) {
+    processPreclusters(mWorkerOutputs[0], digits);
+  } else {
+    std::vector<std::future<void>> workers;
+    for (size_t worker = 1; worker < mWorkerOutputs.size(); worker++) {
+      workers.emplace_back(std::async(std::launch::async, [this, worker, digits]() { processPreclusters(mWorkerOutputs[worker], digits); }));
+    }
+    processPreclusters(mWorkerOutputs[0], digits);
+    for (auto& w : workers) {
+      w.get();
+    }
+  }
+
+  for (auto& output : mWorkerOutputs) {
+    mergeWorkerOutput(output);
   }
 
-  if (print && verbose) {
+  if (verbose) {
     printPreclusters(preClusters, digits);
   }
 }
 
-//_________________________________________________________________________________________________
-// compute the center-of-gravity of a given pre-cluster
-static void CoG(gsl::span<const o2::mch::Digit> precluster, double& Xcog, double& Ycog, bool isWide[2])
+void PhysicsTaskPreclusters::processPreclusters(WorkerOutput& output, gsl::span<const o2::mch::Digit> digits)
 {
+  for (auto* p : output.preClusters) {
+    plotPrecluster(*p, digits, output);
+  }
+}
 
-  double xmin = 1E9;
-  double ymin = 1E9;
-  double xmax = -1E9;
-  double ymax = -1E9;
-  double charge[] = { 0.0, 0.0 };
-  int multiplicity[] = { 0, 0 };
-  isWide[0] = isWide[1] = false;
+void PhysicsTaskPreclusters::mergeWorkerOutput(WorkerOutput& output)
+{
+  for (auto [fecId, channel] : output.elecDen) {
+    mHistogramPseudoeffElec->getDen()->Fill(fecId, channel);
+  }
+  for (auto [fecId, channel] : output.elecNum) {
+    mHistogramPseudoeffElec->getNum()->Fill(fecId, channel);
+  }
+  // the counts are filled one by one, to keep the errors of the histograms with unit weights
+  for (int deIndex = 0; deIndex < static_cast<int>(output.preclustersPerDE.size()); deIndex++) {
+    for (int i = 0; i < output.preclustersPerDE[deIndex]; i++) {
+      mHistogramPreclustersPerDE->getNum()->Fill(deIndex);
+    }
+    for (int i = 0; i < output.preclustersSignalPerDE[deIndex]; i++) {
+      mHistogramPreclustersSignalPerDE->getNum()->Fill(deIndex);
+    }
+  }
+
+  output.preClusters.clear();
+  output.elecDen.clear();
+  output.elecNum.clear();
+  std::fill(output.preclustersPerDE.begin(), output.preclustersPerDE.end(), 0);
+  std::fill(output.preclustersSignalPerDE.begin(), output.preclustersSignalPerDE.end(), 0);
+}
+
+//_________________________________________________________________________________________________
+// charge, multiplicity and center-of-gravity of a pre-cluster, computed in a single pass over its digits
+struct PreclusterInfo {
+  bool cathode[2] = { false, false };   // whether a cathode has digits or not
+  double charge[2] = { 0, 0 };          // total charge on each cathode
+  bool hasSignal[2] = { false, false }; // whether the pre-cluster contains at least one signal-like digit in each cathode
+  int multiplicity[2] = { 0, 0 };       // number of digits in each cathode
   // isWide tells if a given precluster is extended enough on a given cathode. On the bending side for exemple, a wide precluster would have at least 2 pads fired in the x direction (so when clustering it, we obtain a meaningful value for x). If a precluster is not wide and on a single cathode, when clustering, one of the coordinates will not be computed properly and set to the center of the pad by default.
+  bool isWide[2] = { false, false };
+  double Xcog = 0;
+  double Ycog = 0;
+};
+
+static PreclusterInfo analyzePrecluster(gsl::span<const o2::mch::Digit> precluster, const o2::mch::mapping::Segmentation& segment,
+                                        const o2::mch::DigitFilter& isSignalDigit)
+{
+  PreclusterInfo info;
 
   double x[] = { 0.0, 0.0 };
   double y[] = { 0.0, 0.0 };
@@ -234,73 +322,67 @@ static void CoG(gsl::span<const o2::mch::Digit> precluster, double& Xcog, double
   double xsize[] = { 0.0, 0.0 };
   double ysize[] = { 0.0, 0.0 };
 
-  std::set<double> padPos[2];
-
-  int detid = precluster[0].getDetID();
-  const o2::mch::mapping::Segmentation& segment = o2::mch::mapping::segmentation(detid);
+  // range of the pad positions along the non-bending direction of the bending cathode, and vice-versa.
+  // The pre-cluster is wide on a cathode if the range is not empty, i.e. if there are at least two distinct positions.
+  double padPosMin[2] = { 1E9, 1E9 };
+  double padPosMax[2] = { -1E9, -1E9 };
 
-  for (ssize_t i = 0; (unsigned)i < precluster.size(); ++i) {
-    const o2::mch::Digit& digit = precluster[i];
+  for (const o2::mch::Digit& digit : precluster) {
     int padid = digit.getPadID();
+    double adc = digit.getADC();
 
     // position and size of current pad
     double padPosition[2] = { segment.padPositionX(padid), segment.padPositionY(padid) };
     double padSize[2] = { segment.padSizeX(padid), segment.padSizeY(padid) };
 
-    // update of xmin/max et ymin/max
-    xmin = std::min(padPosition[0] - 0.5 * padSize[0], xmin);
-    xmax = std::max(padPosition[0] + 0.5 * padSize[0], xmax);
-    ymin = std::min(padPosition[1] - 0.5 * padSize[1], ymin);
-    ymax = std::max(padPosition[1] + 0.5 * padSize[1], ymax);
-
     // cathode index
     int cathode = segment.isBendingPad(padid) ? 0 : 1;
 
     // update of the cluster position, size, charge and multiplicity
-    x[cathode] += padPosition[0] * digit.getADC();
-    y[cathode] += padPosition[1] * digit.getADC();
+    x[cathode] += padPosition[0] * adc;
+    y[cathode] += padPosition[1] * adc;
     xsize[cathode] += padSize[0];
     ysize[cathode] += padSize[1];
-    charge[cathode] += digit.getADC();
+    info.charge[cathode] += adc;
+    info.multiplicity[cathode] += 1;
+    info.cathode[cathode] = true;
 
-    if (cathode == 0) {
-      padPos[0].insert(padPosition[1]);
-    } else if (cathode == 1) {
-      padPos[1].insert(padPosition[0]);
-    }
+    double pos = (cathode == 0) ? padPosition[1] : padPosition[0];
+    padPosMin[cathode] = std::min(pos, padPosMin[cathode]);
+    padPosMax[cathode] = std::max(pos, padPosMax[cathode]);
 
-    multiplicity[cathode] += 1;
+    if (isSignalDigit(digit)) {
+      info.hasSignal[cathode] = true;
+    }
   }
 
   // Computation of the CoG coordinates for the two cathodes
   for (int cathode = 0; cathode < 2; ++cathode) {
-    if (charge[cathode] != 0) {
-      x[cathode] /= charge[cathode];
-      y[cathode] /= charge[cathode];
+    if (info.charge[cathode] != 0) {
+      x[cathode] /= info.charge[cathode];
+      y[cathode] /= info.charge[cathode];
     }
-    if (multiplicity[cathode] != 0) {
-      double sqrtCharge = sqrt(charge[cathode]);
-      xsize[cathode] /= (multiplicity[cathode] * sqrtCharge);
-      ysize[cathode] /= (multiplicity[cathode] * sqrtCharge);
+    if (info.multiplicity[cathode] != 0) {
+      double sqrtCharge = sqrt(info.charge[cathode]);
+      xsize[cathode] /= (info.multiplicity[cathode] * sqrtCharge);
+      ysize[cathode] /= (info.multiplicity[cathode] * sqrtCharge);
     } else {
       xsize[cathode] = 1E9;
       ysize[cathode] = 1E9;
     }
+    info.isWide[cathode] = (padPosMax[cathode] > padPosMin[cathode]);
   }
 
-  isWide[0] = (padPos[0].size() > 1);
-  isWide[1] = (padPos[1].size() > 1);
-
   // each CoG coordinate is taken from the cathode with the best precision
-  Xcog = (xsize[0] < xsize[1]) ? x[0] : x[1];
-  Ycog = (ysize[0] < ysize[1]) ? y[0] : y[1];
+  info.Xcog = (xsize[0] < xsize[1]) ? x[0] : x[1];
+  info.Ycog = (ysize[0] < ysize[1]) ? y[0] : y[1];
+
+  return info;
 }
 
 //_________________________________________________________________________________________________
-bool PhysicsTaskPreclusters::getFecChannel(int deId, int padId, int& fecId, int& channel)
+bool PhysicsTaskPreclusters::getFecChannel(const o2::mch::mapping::Segmentation& segment, int deId, int padId, int& fecId, int& channel)
 {
-  const o2::mch::mapping::Segmentation& segment = o2::mch::mapping::segmentation(deId);
-
   channel = segment.padDualSampaChannel(padId);
 
   int dsId = segment.padDualSampaId(padId);
@@ -328,7 +410,7 @@ bool PhysicsTaskPreclusters::getFecChannel(int deId, int padId, int& fecId, int&
 }
 
 //_________________________________________________________________________________________________
-bool PhysicsTaskPreclusters::plotPrecluster(const o2::mch::PreCluster& preCluster, gsl::span<const o2::mch::Digit> digits)
+bool PhysicsTaskPreclusters::plotPrecluster(const o2::mch::PreCluster& preCluster, gsl::span<const o2::mch::Digit> digits, WorkerOutput& output)
 {
   // filter out single-pad clusters
   if (preCluster.nDigits < 2) {
@@ -338,49 +420,23 @@ bool PhysicsTaskPreclusters::plotPrecluster(const o2::mch::PreCluster& preCluste
   // get the digits of this precluster
   auto preClusterDigits = digits.subspan(preCluster.firstDigit, preCluster.nDigits);
 
-  // whether a cathode has digits or not
-  bool cathode[2] = { false, false };
-  // total charge on each cathode
-  float chargeSum[2] = { 0, 0 };
-  // largest signal in each cathode
-  float chargeMax[2] = { 0, 0 };
-  // whether the pre-cluster contains at least one signal-like digit in each cathode
-  float hasSignal[2] = { false, false };
-  // number of digits in each cathode
-  int multiplicity[2] = { 0, 0 };
-
   int detid = preClusterDigits[0].getDetID();
-  const o2::mch::mapping::Segmentation& segment = o2::mch::mapping::segmentation(detid);
-
-  // loop over digits and collect information on charge and multiplicity
-  for (const o2::mch::Digit& digit : preClusterDigits) {
-    int padid = digit.getPadID();
-
-    // cathode index
-    int cid = segment.isBendingPad(padid) ? 0 : 1;
-    cathode[cid] = true;
-    chargeSum[cid] += digit.getADC();
-    multiplicity[cid] += 1;
-
-    if (digit.getADC() > chargeMax[cid]) {
-      chargeMax[cid] = digit.getADC();
-    }
-
-    if (mIsSignalDigit(digit)) {
-      hasSignal[cid] = true;
-    }
-  }
-
-  mHistogramPreclustersPerDE->getNum()->Fill(getDEindex(detid));
+  int deIndex = getDEindex(detid);
+  const DEHandles& handles = mDEHandles[deIndex];
+  const o2::mch::mapping::Segmentation& segment = *handles.segment;
+
+  // collect information on charge and multiplicity, and compute center-of-gravity of the charge distribution
+  auto info = analyzePrecluster(preClusterDigits, segment, mIsSignalDigit);
+  const bool* hasSignal = info.hasSignal;
+  const bool* isWide = info.isWide;
+  double Xcog = info.Xcog;
+  double Ycog = info.Ycog;
+
+  output.preclustersPerDE[deIndex] += 1;
   if (hasSignal[0] || hasSignal[1]) {
-    mHistogramPreclustersSignalPerDE->getNum()->Fill(getDEindex(detid));
+    output.preclustersSignalPerDE[deIndex] += 1;
   }
 
-  // compute center-of-gravity of the charge distribution
-  double Xcog, Ycog;
-  bool isWide[2];
-  CoG(preClusterDigits, Xcog, Ycog, isWide);
-
   int padIdB = -1;
   int padIdNB = -1;
   int fecIdB = -1;
@@ -388,31 +444,29 @@ bool PhysicsTaskPreclusters::plotPrecluster(const o2::mch::PreCluster& preCluste
   int fecIdNB = -1;
   int channelNB = -1;
   if (segment.findPadPairByPosition(Xcog, Ycog, padIdB, padIdNB)) {
-    getFecChannel(detid, padIdB, fecIdB, channelB);
-    getFecChannel(detid, padIdNB, fecIdNB, channelNB);
+    getFecChannel(segment, detid, padIdB, fecIdB, channelB);
+    getFecChannel(segment, detid, padIdNB, fecIdNB, channelNB);
   }
 
   // criteria to define a "good" charge cluster in one cathode:
   bool isGoodDen[2] = { hasSignal[1] && isWide[1], hasSignal[0] && isWide[0] };
-  bool isGoodNum[2] = { cathode[0] && isWide[0], cathode[1] };
+  bool isGoodNum[2] = { info.cathode[0] && isWide[0], info.cathode[1] };
 
   // Filling histograms to be used for Pseudo-efficiency computation
   if (isGoodDen[0]) {
     // good cluster on non-bending side, check if there is data from the bending side as well
     if (fecIdB >= 0 && channelB >= 0) {
-      mHistogramPseudoeffElec->getDen()->Fill(fecIdB, channelB);
+      output.elecDen.emplace_back(fecIdB, channelB);
     }
-    auto hXY0 = mHistogramPreclustersXY[1].find(detid);
-    if ((hXY0 != mHistogramPreclustersXY[1].end()) && (hXY0->second != NULL)) {
-      hXY0->second->Fill(Xcog, Ycog, 0.5, 0.5);
+    if (handles.preclustersXY[1]) {
+      handles.preclustersXY[1]->Fill(Xcog, Ycog, 0.5, 0.5);
     }
     if (isGoodNum[0]) { // Check if associated to something on Bending
       if (fecIdB >= 0 && channelB >= 0) {
-        mHistogramPseudoeffElec->getNum()->Fill(fecIdB, channelB);
+        output.elecNum.emplace_back(fecIdB, channelB);
       }
-      auto hXY1 = mHistogramPreclustersXY[0].find(detid);
-      if ((hXY1 != mHistogramPreclustersXY[0].end()) && (hXY1->second != NULL)) {
-        hXY1->second->Fill(Xcog, Ycog, 0.5, 0.5);
+      if (handles.preclustersXY[0]) {
+        handles.preclustersXY[0]->Fill(Xcog, Ycog, 0.5, 0.5);
       }
     }
   }
@@ -420,19 +474,17 @@ bool PhysicsTaskPreclusters::plotPrecluster(const o2::mch::PreCluster& preCluste
   if (isGoodDen[1]) {
     // good cluster on bending side, check if there is data from the non-bending side as well
     if (fecIdNB >= 0 && channelNB >= 0) {
-      mHistogramPseudoeffElec->getDen()->Fill(fecIdNB, channelNB);
+      output.elecDen.emplace_back(fecIdNB, channelNB);
     }
-    auto hXY0 = mHistogramPreclustersXY[3].find(detid);
-    if ((hXY0 != mHistogramPreclustersXY[3].end()) && (hXY0->second != NULL)) {
-      hXY0->second->Fill(Xcog, Ycog, 0.5, 0.5);
+    if (handles.preclustersXY[3]) {
+      handles.preclustersXY[3]->Fill(Xcog, Ycog, 0.5, 0.5);
     }
     if (isGoodNum[1]) { // Check if associated to something on Non-Bending
       if (fecIdNB >= 0 && channelNB >= 0) {
-        mHistogramPseudoeffElec->getNum()->Fill(fecIdNB, channelNB);
+        output.elecNum.emplace_back(fecIdNB, channelNB);
       }
-      auto hXY1 = mHistogramPreclustersXY[2].find(detid);
-      if ((hXY1 != mHistogramPreclustersXY[2].end()) && (hXY1->second != NULL)) {
-        hXY1->second->Fill(Xcog, Ycog, 0.5, 0.5);
+      if (handles.preclustersXY[2]) {
+        handles.preclustersXY[2]->Fill(Xcog, Ycog, 0.5, 0.5);
       }
     }
   }
@@ -451,33 +503,27 @@ bool PhysicsTaskPreclusters::plotPrecluster(const o2::mch::PreCluster& preCluste
 
   if (hasSignal[0] || hasSignal[1]) {
     // cluster size, separately on each cathode and combined
-    auto hSize = mHistogramClsizeDE.find(detid);
-    if ((hSize != mHistogramClsizeDE.end()) && (hSize->second != NULL)) {
-      hSize->second->Fill(multiplicity[0] + multiplicity[1]);
+    if (handles.clusterSize) {
+      handles.clusterSize->Fill(info.multiplicity[0] + info.multiplicity[1]);
     }
-    hSize = mHistogramClsizeDE_B.find(detid);
-    if ((hSize != mHistogramClsizeDE_B.end()) && (hSize->second != NULL)) {
-      hSize->second->Fill(multiplicity[0]);
+    if (handles.clusterSizeB) {
+      handles.clusterSizeB->Fill(info.multiplicity[0]);
     }
-    hSize = mHistogramClsizeDE_NB.find(detid);
-    if ((hSize != mHistogramClsizeDE_NB.end()) && (hSize->second != NULL)) {
-      hSize->second->Fill(multiplicity[1]);
+    if (handles.clusterSizeNB) {
+      handles.clusterSizeNB->Fill(info.multiplicity[1]);
     }
 
     // total cluster charge
-    float chargeTot = chargeSum[0] + chargeSum[1];
-    auto hCharge = mHistogramClchgDE.find(detid);
-    if ((hCharge != mHistogramClchgDE.end()) && (hCharge->second != NULL)) {
-      hCharge->second->Fill(chargeTot);
+    float chargeTot = info.charge[0] + info.charge[1];
+    if (handles.clusterCharge) {
+      handles.clusterCharge->Fill(chargeTot);
     }
-
-    auto hChargeOnCycle = mHistogramClchgDEOnCycle.find(detid);
-    if ((hChargeOnCycle != mHistogramClchgDEOnCycle.end()) && (hChargeOnCycle->second != NULL)) {
-      hChargeOnCycle->second->Fill(chargeTot);
+    if (handles.clusterChargeOnCycle) {
+      handles.clusterChargeOnCycle->Fill(chargeTot);
     }
   }
 
-  return (cathode[0] && cathode[1]);
+  return (info.cathode[0] && info.cathode[1]);
 }
 
 //_________________________________________________________________________________________________
@@ -502,12 +548,10 @@ void PhysicsTaskPreclusters::printPrecluster(gsl::span<const o2::mch::Digit> pre
     }
   }
 
-  double Xcog, Ycog;
-  bool isWide[2];
-  CoG(preClusterDigits, Xcog, Ycog, isWide);
+  auto info = analyzePrecluster(preClusterDigits, segment, mIsSignalDigit);
 
   ILOG(Info, Support) << "\n\n\n====================\n"
-                      << "[pre-cluster] nDigits = " << preClusterDigits.size() << "  charge = " << chargeSum[0] << " " << chargeSum[1] << "   CoG = " << Xcog << "," << Ycog << AliceO2::InfoLogger::InfoLogger::endm;
+                      << "[pre-cluster] nDigits = " << preClusterDigits.size() << "  charge = " << chargeSum[0] << " " << chargeSum[1] << "   CoG = " << info.Xcog << "," << info.Ycog << AliceO2::InfoLogger::InfoLogger::endm;
   for (auto& d : preClusterDigits) {
     float X = segment.padPositionX(d.getPadID());
     float Y = segment.padPositionY(d.getPadID());
@@ -0,0 +1,53 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   testDEindex.cxx
+///
+
+#include "MCH/GlobalHistogram.h"
+#include "MCHRawElecMap/Mapper.h"
+
+#include <algorithm>
+#include <set>
+
+#define BOOST_TEST_MODULE DEindex test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+namespace o2::quality_control_modules::muonchambers
+{
+
+BOOST_AUTO_TEST_CASE(de_indices_fit_in_tables_of_max_plus_one)
+{
+  // the per-DE tables (e.g. in PhysicsTaskPreclusters) have getDEindexMax() + 1 entries
+  const int tableSize = getDEindexMax() + 1;
+  std::set<int> indices;
+  for (auto de : o2::mch::raw::deIdsForAllMCH) {
+    int index = getDEindex(de);
+    BOOST_CHECK_GE(index, 0);
+    BOOST_CHECK_LT(index, tableSize);
+    indices.insert(index);
+  }
+  // each DE has its own entry
+  BOOST_CHECK_EQUAL(indices.size(), o2::mch::raw::deIdsForAllMCH.size());
+}
+
+BOOST_AUTO_TEST_CASE(last_de_has_the_last_index)
+{
+  // DE 1025 is the last one, its index is the maximum one and it must not be dropped
+  BOOST_CHECK_EQUAL(getDEindex(1025), getDEindexMax());
+  BOOST_CHECK_EQUAL(*std::max_element(o2::mch::raw::deIdsForAllMCH.begin(), o2::mch::raw::deIdsForAllMCH.end()), 1025);
+}
+
+} // namespace o2::quality_control_modules::muonchambers
@@ -169,6 +169,9 @@ class RawQcTask final : public TaskInterface
   void CreateLEDHistograms();
   void FillLEDHistograms(const gsl::span<const o2::phos::Cell>& cells, const gsl::span<const o2::phos::TriggerRecord>& tr);
 
+  void FinalizePedestalHistograms();
+  void FinalizeLEDHistograms();
+
   void CreateTRUHistograms();
   void FillTRUHistograms(const gsl::span<const o2::phos::Cell>& cells, const gsl::span<const o2::phos::TriggerRecord>& tr);
 
@@ -177,10 +180,11 @@ class RawQcTask final : public TaskInterface
   static constexpr short kMaxErr = 5;
   static constexpr short kOcccupancyTh = 10;
 
-  int mMode = 0;           ///< Possible modes: 0(def): Physics, 1: Pedestals, 2: LED
-  bool mFinalized = false; ///< if final histograms calculated
-  bool mCheckChi2 = false; ///< scan Chi2 distributions
-  bool mTrNoise = false;   ///< check mathing of trigger summary tables and tr.digits
+  int mMode = 0;              ///< Possible modes: 0(def): Physics, 1: Pedestals, 2: LED
+  bool mFinalized = false;    ///< if final histograms calculated
+  bool mCheckChi2 = false;    ///< scan Chi2 distributions
+  bool mTrNoise = false;      ///< check mathing of trigger summary tables and tr.digits
+  int mPeakSearchThreads = 1; ///< number of threads searching the LED peaks at the end of cycle
 
   std::array<TH1F*, kNhist1D> mHist1D = { nullptr };                      ///< Array of 1D histograms
   std::array<TH2F*, kNhist2D> mHist2D = { nullptr };                      ///< Array of 2D histograms
@@ -189,8 +193,25 @@ class RawQcTask final : public TaskInterface
 
   bool mInitBadMap = true;                           //! BadMap had to be initialized
   const o2::phos::BadChannelsMap* mBadMap = nullptr; //! Bad map for comparison
-  std::unique_ptr<TSpectrum> mSpSearcher;
+  std::vector<std::unique_ptr<TSpectrum>> mSpSearchers; //! one peak searcher per thread
   std::vector<TH1S> mSpectra;
+  std::vector<char> mSpectrumChanged; //! LED spectra filled since the last peak search
+  std::vector<int> mChangedSpectra;   //! indices of the spectra to be searched at the end of cycle
+
+  /// \brief Module and bin of a cell in the 64x56 cell histograms
+  struct CellBin {
+    short mod = -1;
+    int bin = 0;
+  };
+  std::vector<CellBin> mCellBins; //! for each absId-1
+
+  /// \brief Running sums of the pedestal runs for each absId-1
+  struct PedestalSums {
+    std::vector<unsigned int> n;
+    std::vector<double> mean;
+    std::vector<double> rms;
+  };
+  std::array<PedestalSums, 2> mPedestalSums; //! for low and high gain
 };
 
 } // namespace o2::quality_control_modules::phos
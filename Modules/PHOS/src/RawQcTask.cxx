@@ -19,7 +19,10 @@
 #include <TH2.h>
 #include <TMath.h>
 #include <TSpectrum.h>
+#include <TROOT.h>
 #include <cfloat>
+#include <algorithm>
+#include <future>
 
 #include "QualityControl/QcInfoLogger.h"
 #include "PHOS/RawQcTask.h"
@@ -103,12 +106,30 @@ void RawQcTask::initialize(o2::framework::InitContext& /*ctx*/)
     }
   }
 
+  if (auto param = mCustomParameters.find("peakSearchThreads"); param != mCustomParameters.end()) {
+    mPeakSearchThreads = std::max(1, std::stoi(param->second));
+    ILOG(Info, Support) << "Searching LED peaks in " << mPeakSearchThreads << " threads" << AliceO2::InfoLogger::InfoLogger::endm;
+    if (mPeakSearchThreads > 1) {
+      ROOT::EnableThreadSafety();
+    }
+  }
+
   InitHistograms();
 }
 
 void RawQcTask::InitHistograms()
 {
 
+  // Module and bin of each cell in the 64x56 cell histograms
+  mCellBins.resize(o2::phos::Mapping::NCHANNELS);
+  for (int absId = 1; absId <= o2::phos::Mapping::NCHANNELS; absId++) {
+    char relid[3];
+    if (o2::phos::Geometry::absToRelNumbering(absId, relid)) {
+      mCellBins[absId - 1].mod = relid[0] - 1;
+      mCellBins[absId - 1].bin = relid[1] + (64 + 2) * relid[2]; // same as FindBin(relid[1] - 0.5, relid[2] - 0.5)
+    }
+  }
+
   // First init general histograms for any mode
 
   // Statistics histograms
@@ -190,27 +211,9 @@ void RawQcTask::startOfCycle()
           mHist2D[kChi2M1 + mod]->Multiply(mHist2D[kChi2NormM1 + mod]);
         }
       }
-      if (mMode != 1) { // for mode 1 another check below
-        mFinalized = false;
-      }
-    }
-  }
-
-  if (mMode == 1) {   // Pedestals
-    if (mFinalized) { // means were already calculated
-      for (Int_t mod = 0; mod < 4; mod++) {
-        if (mHist2DMean[kHGmeanM1 + mod]) {
-          mHist2DMean[kHGmeanM1 + mod]->Multiply(mHist2D[kHGoccupM1 + mod]);
-          mHist2DMean[kHGrmsM1 + mod]->Multiply(mHist2D[kHGoccupM1 + mod]);
-        }
-        if (mHist2DMean[kLGmeanM1 + mod]) {
-          mHist2DMean[kLGmeanM1 + mod]->Multiply(mHist2D[kLGoccupM1 + mod]);
-          mHist2DMean[kLGrmsM1 + mod]->Multiply(mHist2D[kLGoccupM1 + mod]);
-        }
-      }
-      mFinalized = false;
     }
   }
+  mFinalized = false;
 }
 
 void RawQcTask::monitorData(o2::framework::ProcessingContext& ctx)
@@ -307,87 +310,116 @@ void RawQcTask::endOfCycle()
     }
   }
 
-  if (mMode == 1) {   // Pedestals
-    if (mFinalized) { // means were already calculated
-      return;
-    }
+  if (mMode == 1) { // Pedestals
+    FinalizePedestalHistograms();
+  }
+  //==========LED===========
+  if (mMode == 2) { // LED
+    FinalizeLEDHistograms();
+  }
+  mFinalized = true;
+}
+
+void RawQcTask::FinalizePedestalHistograms()
+{
+  // The means, RMS and occupancies are derived from the running sums in one pass over the cells
+  const std::array<short, 2> meanHist = { kLGmeanM1, kHGmeanM1 };
+  const std::array<short, 2> rmsHist = { kLGrmsM1, kHGrmsM1 };
+  const std::array<short, 2> occupHist = { kLGoccupM1, kHGoccupM1 };
+  const std::array<short, 2> meanSummary = { kLGmeanSummaryM1, kHGmeanSummaryM1 };
+  const std::array<short, 2> rmsSummary = { kLGrmsSummaryM1, kHGrmsSummaryM1 };
+
+  for (int gain = 0; gain < 2; gain++) {
+    const auto& sums = mPedestalSums[gain];
+    if (sums.n.empty()) {
+      continue;
+    }
+    std::array<std::vector<double>, 4> means;
+    std::array<std::vector<double>, 4> rms;
+    std::array<double, 4> entries = { 0 };
+    std::array<double, 4> occMin;
+    occMin.fill(1.e+9);
+    std::array<double, 4> occMax = { 0 };
     for (Int_t mod = 0; mod < 4; mod++) {
-      if (mHist2DMean[kHGmeanM1 + mod]) {
-        mHist2DMean[kHGmeanM1 + mod]->Divide(mHist2D[kHGoccupM1 + mod]);
-        mHist2DMean[kHGrmsM1 + mod]->Divide(mHist2D[kHGoccupM1 + mod]);
-        mHist1D[kHGmeanSummaryM1 + mod]->Reset();
-        mHist1D[kHGrmsSummaryM1 + mod]->Reset();
-        double occMin = 1.e+9;
-        double occMax = 0.;
-        for (int iz = 1; iz <= 64; iz++) {
-          for (int ix = 1; ix <= 56; ix++) {
-            float a = mHist2DMean[kHGmeanM1 + mod]->GetBinContent(iz, ix);
-            if (a > 0) {
-              mHist1D[kHGmeanSummaryM1 + mod]->Fill(a);
-            }
-            a = mHist2DMean[kHGrmsM1 + mod]->GetBinContent(iz, ix);
-            if (a > 0) {
-              mHist1D[kHGrmsSummaryM1 + mod]->Fill(a);
-            }
-            a = mHist2D[kHGoccupM1 + mod]->GetBinContent(iz, ix);
-            if (a > 0) {
-              if (a < occMin)
-                occMin = a;
-              if (a > occMax)
-                occMax = a;
-            }
-          }
-        }
-        mHist2D[kHGoccupM1 + mod]->SetMinimum(occMin);
-        mHist2D[kHGoccupM1 + mod]->SetMaximum(occMax);
+      if (mHist2DMean[meanHist[gain] + mod]) {
+        mHist2DMean[meanHist[gain] + mod]->Reset();
+        mHist2DMean[rmsHist[gain] + mod]->Reset();
+        mHist2D[occupHist[gain] + mod]->Reset();
       }
-      if (mHist2DMean[kLGmeanM1 + mod]) {
-        mHist2DMean[kLGmeanM1 + mod]->Divide(mHist2D[kLGoccupM1 + mod]);
-        mHist2DMean[kLGrmsM1 + mod]->Divide(mHist2D[kLGoccupM1 + mod]);
-        mHist1D[kLGmeanSummaryM1 + mod]->Reset();
-        mHist1D[kLGrmsSummaryM1 + mod]->Reset();
-        double occMin = 1.e+9;
-        double occMax = 0.;
-        for (int iz = 1; iz <= 64; iz++) {
-          for (int ix = 1; ix <= 56; ix++) {
-            float a = mHist2DMean[kLGmeanM1 + mod]->GetBinContent(iz, ix);
-            if (a > 0) {
-              mHist1D[kLGmeanSummaryM1 + mod]->Fill(a);
-            }
-            a = mHist2DMean[kLGrmsM1 + mod]->GetBinContent(iz, ix);
-            if (a > 0) {
-              mHist1D[kLGrmsSummaryM1 + mod]->Fill(a);
-            }
-            a = mHist2D[kLGoccupM1 + mod]->GetBinContent(iz, ix);
-            if (a > 0) {
-              if (a < occMin)
-                occMin = a;
-              if (a > occMax)
-                occMax = a;
-            }
-          }
-        }
-        mHist2D[kLGoccupM1 + mod]->SetMinimum(occMin);
-        mHist2D[kLGoccupM1 + mod]->SetMaximum(occMax);
+    }
+
+    for (size_t cell = 0; cell < sums.n.size(); cell++) {
+      const auto n = sums.n[cell];
+      const auto& cellBin = mCellBins[cell];
+      if (n == 0 || cellBin.mod < 0 || cellBin.mod >= 4 || !mHist2DMean[meanHist[gain] + cellBin.mod]) {
+        continue;
+      }
+      const short mod = cellBin.mod;
+      double mean = sums.mean[cell] / n;
+      double meanRms = sums.rms[cell] / n;
+      mHist2DMean[meanHist[gain] + mod]->GetArray()[cellBin.bin] = mean;
+      mHist2DMean[rmsHist[gain] + mod]->GetArray()[cellBin.bin] = meanRms;
+      mHist2D[occupHist[gain] + mod]->GetArray()[cellBin.bin] = n;
+      entries[mod] += n;
+      if (mean > 0) {
+        means[mod].push_back(mean);
       }
+      if (meanRms > 0) {
+        rms[mod].push_back(meanRms);
+      }
+      occMin[mod] = std::min<double>(occMin[mod], n);
+      occMax[mod] = std::max<double>(occMax[mod], n);
     }
-    mFinalized = true;
-  }
-  //==========LED===========
-  if (mMode == 2) { // LED
-    ILOG(Info, Support) << " Caclulating number of peaks" << AliceO2::InfoLogger::InfoLogger::endm;
-    for (unsigned int absId = 1793; absId <= o2::phos::Mapping::NCHANNELS; absId++) {
-      int npeaks = mSpSearcher->Search(&(mSpectra[absId - 1793]), 2, "goff", 0.1);
-      char relid[3];
-      o2::phos::Geometry::absToRelNumbering(absId, relid);
-      short mod = relid[0] - 1;
-      int ibin = mHist2DMean[kLEDNpeaksM1 + mod]->FindBin(relid[1] - 0.5, relid[2] - 0.5);
-      mHist2DMean[kLEDNpeaksM1 + mod]->SetBinContent(ibin, npeaks);
+
+    for (Int_t mod = 0; mod < 4; mod++) {
+      if (!mHist2DMean[meanHist[gain] + mod]) {
+        continue;
+      }
+      mHist2DMean[meanHist[gain] + mod]->SetEntries(entries[mod]);
+      mHist2DMean[rmsHist[gain] + mod]->SetEntries(entries[mod]);
+      mHist2D[occupHist[gain] + mod]->SetEntries(entries[mod]);
+      mHist2D[occupHist[gain] + mod]->SetMinimum(occMin[mod]);
+      mHist2D[occupHist[gain] + mod]->SetMaximum(occMax[mod]);
+      mHist1D[meanSummary[gain] + mod]->Reset();
+      mHist1D[rmsSummary[gain] + mod]->Reset();
+      if (!means[mod].empty()) {
+        mHist1D[meanSummary[gain] + mod]->FillN(means[mod].size(), means[mod].data(), nullptr);
+      }
+      if (!rms[mod].empty()) {
+        mHist1D[rmsSummary[gain] + mod]->FillN(rms[mod].size(), rms[mod].data(), nullptr);
+      }
     }
-    ILOG(Info, Support) << " Caclulating number of peaks done" << AliceO2::InfoLogger::InfoLogger::endm;
   }
 }
 
+void RawQcTask::FinalizeLEDHistograms()
+{
+  // The peaks are searched only in the spectra which were filled since the last search
+  ILOG(Info, Support) << " Caclulating number of peaks in " << mChangedSpectra.size() << " channels" << AliceO2::InfoLogger::InfoLogger::endm;
+  std::vector<int> npeaks(mChangedSpectra.size());
+  auto search = [this, &npeaks](size_t worker) {
+    for (size_t i = worker; i < mChangedSpectra.size(); i += mSpSearchers.size()) {
+      npeaks[i] = mSpSearchers[worker]->Search(&(mSpectra[mChangedSpectra[i]]), 2, "goff", 0.1);
+    }
+  };
+  std::vector<std::future<void>> jobs;
+  for (size_t worker = 1; worker < mSpSearchers.size(); worker++) {
+    jobs.push_back(std::async(std::launch::async, search, worker));
+  }
+  search(0);
+  for (auto& job : jobs) {
+    job.get();
+  }
+
+  for (size_t i = 0; i < mChangedSpectra.size(); i++) {
+    const auto& cellBin = mCellBins[mChangedSpectra[i] + 1793 - 1];
+    mHist2DMean[kLEDNpeaksM1 + cellBin.mod]->SetBinContent(cellBin.bin, npeaks[i]);
+    mSpectrumChanged[mChangedSpectra[i]] = 0;
+  }
+  mChangedSpectra.clear();
+  ILOG(Info, Support) << " Caclulating number of peaks done" << AliceO2::InfoLogger::InfoLogger::endm;
+}
+
 void RawQcTask::endOfActivity(Activity& /*activity*/)
 {
   ILOG(Info, Support) << "endOfActivity" << AliceO2::InfoLogger::InfoLogger::endm;
@@ -410,6 +442,11 @@ void RawQcTask::reset()
       mHist2D[i]->Reset();
     }
   }
+  for (auto& sums : mPedestalSums) {
+    std::fill(sums.n.begin(), sums.n.end(), 0);
+    std::fill(sums.mean.begin(), sums.mean.end(), 0.);
+    std::fill(sums.rms.begin(), sums.rms.end(), 0.);
+  }
 }
 void RawQcTask::FillLEDHistograms(const gsl::span<const o2::phos::Cell>& cells, const gsl::span<const o2::phos::TriggerRecord>& cellsTR)
 {
@@ -421,7 +458,12 @@ void RawQcTask::FillLEDHistograms(const gsl::span<const o2::phos::Cell>& cells,
     for (int i = firstCellInEvent; i < lastCellInEvent; i++) {
       const o2::phos::Cell c = cells[i];
       if (!c.getTRU() && c.getHighGain()) {
-        mSpectra[c.getAbsId() - 1793].Fill(c.getEnergy());
+        const int index = c.getAbsId() - 1793;
+        mSpectra[index].Fill(c.getEnergy());
+        if (!mSpectrumChanged[index]) {
+          mSpectrumChanged[index] = 1;
+          mChangedSpectra.push_back(index);
+        }
       }
     }
   }
@@ -543,34 +585,20 @@ void RawQcTask::FillPhysicsHistograms(const gsl::span<const o2::phos::Cell>& cel
 
 void RawQcTask::FillPedestalHistograms(const gsl::span<const o2::phos::Cell>& cells, const gsl::span<const o2::phos::TriggerRecord>& cellsTR)
 {
-  if (mFinalized) {
-    for (Int_t mod = 0; mod < 4; mod++) {
-      mHist2DMean[kHGmeanM1 + mod]->Multiply(mHist2D[kHGoccupM1 + mod]);
-      mHist2DMean[kHGrmsM1 + mod]->Multiply(mHist2D[kHGoccupM1 + mod]);
-      mHist2DMean[kLGmeanM1 + mod]->Multiply(mHist2D[kLGoccupM1 + mod]);
-      mHist2DMean[kLGrmsM1 + mod]->Multiply(mHist2D[kLGoccupM1 + mod]);
-    }
-    mFinalized = false;
-  }
-
+  // only the running sums are updated here, the histograms are derived from them at the end of the cycle
   for (const auto& tr : cellsTR) {
     int firstCellInEvent = tr.getFirstEntry();
     int lastCellInEvent = firstCellInEvent + tr.getNumberOfObjects();
     for (int i = firstCellInEvent; i < lastCellInEvent; i++) {
-      const o2::phos::Cell c = cells[i];
+      const o2::phos::Cell& c = cells[i];
       short address = c.getAbsId();
-      char relid[3];
-      o2::phos::Geometry::absToRelNumbering(address, relid);
-      short mod = relid[0] - 1;
-      if (c.getHighGain()) {
-        mHist2DMean[kHGmeanM1 + mod]->Fill(relid[1] - 0.5, relid[2] - 0.5, c.getEnergy());
-        mHist2DMean[kHGrmsM1 + mod]->Fill(relid[1] - 0.5, relid[2] - 0.5, 1.e+7 * c.getTime()); // to store in Cells format
-        mHist2D[kHGoccupM1 + mod]->Fill(relid[1] - 0.5, relid[2] - 0.5);
-      } else {
-        mHist2DMean[kLGmeanM1 + mod]->Fill(relid[1] - 0.5, relid[2] - 0.5, c.getEnergy());
-        mHist2DMean[kLGrmsM1 + mod]->Fill(relid[1] - 0.5, relid[2] - 0.5, 1.e+7 * c.getTime());
-        mHist2D[kLGoccupM1 + mod]->Fill(relid[1] - 0.5, relid[2] - 0.5);
+      if (address < 1 || address > o2::phos::Mapping::NCHANNELS) {
+        continue;
       }
+      auto& sums = mPedestalSums[c.getHighGain() ? 1 : 0];
+      sums.n[address - 1]++;
+      sums.mean[address - 1] += c.getEnergy();
+      sums.rms[address - 1] += 1.e+7 * c.getTime(); // to store in Cells format
     }
   }
 }
@@ -578,6 +606,11 @@ void RawQcTask::FillPedestalHistograms(const gsl::span<const o2::phos::Cell>& ce
 void RawQcTask::CreatePedestalHistograms()
 {
   // Prepare historams for pedestal run QA
+  for (auto& sums : mPedestalSums) {
+    sums.n.assign(o2::phos::Mapping::NCHANNELS, 0);
+    sums.mean.assign(o2::phos::Mapping::NCHANNELS, 0.);
+    sums.rms.assign(o2::phos::Mapping::NCHANNELS, 0.);
+  }
 
   for (Int_t mod = 0; mod < 4; mod++) {
     if (!mHist2DMean[kHGmeanM1 + mod]) {
@@ -790,10 +823,13 @@ void RawQcTask::CreateLEDHistograms()
     }
   }
   // Prepare internal array of histos and final plot with number of peaks per channel
-  mSpSearcher = std::make_unique<TSpectrum>(20);
+  for (int i = 0; i < mPeakSearchThreads; i++) {
+    mSpSearchers.emplace_back(std::make_unique<TSpectrum>(20));
+  }
   for (unsigned int absId = 1793; absId <= o2::phos::Mapping::NCHANNELS; absId++) {
     mSpectra.emplace_back(Form("SpChannel%d", absId), "", 487, 50., 1024.);
   }
+  mSpectrumChanged.assign(mSpectra.size(), 0);
 }
 void RawQcTask::CreateTRUHistograms()
 {
@@ -78,7 +78,7 @@ class TaskFT0TOF final : public TaskInterface
   void endOfActivity(Activity& activity) override;
   void reset() override;
 
-  void processEvent(const std::vector<MyTrack>& tracks);
+  void processEvent(gsl::span<const MyTrack> tracks);
   // track selection
   bool selectTrack(o2::tpc::TrackTPC const& track);
   void setMinPtCut(float v) { mMinPtCut = v; }
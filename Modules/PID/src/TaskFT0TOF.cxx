@@ -161,7 +161,7 @@ void TaskFT0TOF::startOfCycle()
 void TaskFT0TOF::monitorData(o2::framework::ProcessingContext& ctx)
 {
   ++mTF;
-  ILOG(Info, Support) << " Processing TF: " << mTF << ENDM;
+  ILOG(Debug, Devel) << " Processing TF: " << mTF << ENDM;
 
   mRecoCont.collectData(ctx, *mDataRequest.get());
 
@@ -171,7 +171,8 @@ void TaskFT0TOF::monitorData(o2::framework::ProcessingContext& ctx)
     mITSTPCTOFMatches = mRecoCont.getITSTPCTOFMatches();
     mTPCTracks = mRecoCont.getTPCTracks();
 
-    mMyTracks.clear();
+    mMyTracks.clear(); // the capacity is kept from one TF to the next
+    mMyTracks.reserve(mITSTPCTOFMatches.size());
 
     // loop over TOF MatchInfo
     for (const auto& matchTOF : mITSTPCTOFMatches) {
@@ -186,37 +187,28 @@ void TaskFT0TOF::monitorData(o2::framework::ProcessingContext& ctx)
         continue;
       }
 
-      mMyTracks.push_back(MyTrack(matchTOF, trk));
+      mMyTracks.emplace_back(matchTOF, trk);
 
     } // END loop on TOF matches
 
-    std::vector<MyTrack> tracks;
-
-    // sorting matching in time
+    // sorting matching in time, the tracks are moved only once and the candidates below are ranges of this buffer
     std::sort(mMyTracks.begin(), mMyTracks.end(),
-              [](MyTrack a, MyTrack b) { return a.tofSignalDouble() < b.tofSignalDouble(); });
-
-    for (int i = 0; i < mMyTracks.size(); i++) { // loop looking for interaction candidates
-      tracks.clear();
-      int ntrk = 1;
-      double time = mMyTracks[i].tofSignalDouble();
-      tracks.emplace_back(mMyTracks[i]);
-      for (; i < mMyTracks.size(); i++) {
-        double timeCurrent = mMyTracks[i].tofSignalDouble();
-        if (timeCurrent - time > 100E3) {
-          i--;
-          break;
-        }
-        tracks.emplace_back(mMyTracks[i]);
-        ntrk++;
-      }
-      if (ntrk > 0) { // good candidate with time
-        processEvent(tracks);
+              [](const MyTrack& a, const MyTrack& b) { return a.tofSignalDouble() < b.tofSignalDouble(); });
+
+    // loop looking for interaction candidates: the tracks within 100 ns of the first one of the candidate
+    const gsl::span<const MyTrack> sortedTracks(mMyTracks);
+    for (size_t first = 0; first < sortedTracks.size();) {
+      const double time = sortedTracks[first].tofSignalDouble();
+      size_t last = first + 1;
+      while (last < sortedTracks.size() && sortedTracks[last].tofSignalDouble() - time <= 100E3) {
+        last++;
       }
+      processEvent(sortedTracks.subspan(first, last - first));
+      first = last;
     }
   } // END if track is ITS-TPC
 
-  ILOG(Info, Support) << " Processed! " << ENDM;
+  ILOG(Debug, Devel) << " Processed! " << ENDM;
   return;
 }
 
@@ -247,17 +239,17 @@ void TaskFT0TOF::reset()
   mHistT0ResEvTimeMult->Reset();
 }
 
-void TaskFT0TOF::processEvent(const std::vector<MyTrack>& tracks)
+void TaskFT0TOF::processEvent(gsl::span<const MyTrack> tracks)
 {
 
-  auto evtime = o2::tof::evTimeMaker<std::vector<MyTrack>, MyTrack, MyFilter>(tracks);
+  auto evtime = o2::tof::evTimeMaker<gsl::span<const MyTrack>, MyTrack, MyFilter>(tracks);
+  const auto mMultiplicity = evtime.mEventTimeMultiplicity;
 
   int nt = 0;
-  for (auto& track : tracks) {
+  for (const auto& track : tracks) {
 
     float mT0 = evtime.mEventTime;
     float mT0Res = evtime.mEventTimeError;
-    const auto mMultiplicity = evtime.mEventTimeMultiplicity;
     //
     evtime.removeBias<MyTrack, MyFilter>(track, nt, mT0, mT0Res);
 
@@ -23,6 +23,9 @@
 // ROOT includes
 #include "TH1.h"
 #include "TMath.h"
+#include "TArrayD.h"
+#include "TArrayF.h"
+#include "TArrayI.h"
 
 // QC includes
 #include "QualityControl/QcInfoLogger.h"
@@ -54,6 +57,10 @@ class Counter
   /// @param index Index in the counter array to increment by one
   void Count(const unsigned int& index) { Add(index, 1); }
 
+  /// Function to add the content of another counter of the same kind, e.g. filled in a different thread
+  /// @param other Counter whose content is added to this one
+  void Merge(const Counter<size, labels>& other);
+
   /// Function to reset counters to zero
   void Reset();
 
@@ -79,11 +86,20 @@ class Counter
   constexpr bool HasLabel(const unsigned int& index) const;
 
   /// Function to make a histogram out of the counters. If a counter has labels defined these are used as axis labels, if not this will not be done.
+  /// The histogram is then bound to the counter, so its labels do not need to be validated when filling it.
   /// @param histogram histogram to shape in order to have room for the counter size
   /// @returns Returns 0 if everything went OK
   int MakeHistogram(TH1* histogram) const;
 
-  /// Function to fill a histogram with the counters
+  /// Function to check that a histogram can accomodate the counter, i.e. that it has the same size and labels.
+  /// The result is cached, so that the following fills of the same histogram skip the validation.
+  /// @param histogram The histogram to validate
+  /// @returns Returns 0 if everything went OK
+  int BindHistogram(const TH1* histogram) const;
+
+  /// Function to fill a histogram with the counters.
+  /// Counts are copied directly into the bin array, errors are not set explicitly: ROOT computes them as the square root
+  /// of the content, or from the sum of weights squared (set to the counts) if the histogram stores it.
   /// @param histogram The histogram to fill
   /// @param biny Y offset to fill to histogram, useful for TH2 and TH3
   /// @param binz Z offset to fill to histogram, useful for TH3
@@ -106,6 +122,11 @@ class Counter
   /// Containers to fill
   std::array<uint32_t, size> counter = { 0 };
   uint32_t mTotal = 0;
+  mutable const TH1* mBoundHistogram = nullptr; /// Last histogram whose binning and labels were validated against the counter
+
+  /// Function to copy the non empty counts into an array, starting at the given position
+  template <typename T>
+  void CopyNonEmpty(T* destination) const;
 };
 
 ////////////////////
@@ -124,6 +145,15 @@ void Counter<size, labels>::Add(const unsigned int& index, const uint32_t& weigh
   counter[index] += weight;
 }
 
+template <const unsigned int size, const char* labels[size]>
+void Counter<size, labels>::Merge(const Counter<size, labels>& other)
+{
+  LOG(debug) << "Merging Counter";
+  for (unsigned int i = 0; i < size; i++) {
+    counter[i] += other.counter[i];
+  }
+}
+
 template <const unsigned int size, const char* labels[size]>
 void Counter<size, labels>::Reset()
 {
@@ -201,6 +231,7 @@ int Counter<size, labels>::MakeHistogram(TH1* histogram) const
     LOG(debug) << "Setting bin " << i + 1 << "/" << size << " to contain counter for '" << labels[i] << "' (index " << i << "/" << size - 1 << ")";
     axis->SetBinLabel(i + 1, labels[i]);
   }
+  mBoundHistogram = histogram;
 #else
   unsigned int histo_size = size;
   if (labels != nullptr) { // Only if labels are defined
@@ -238,9 +269,71 @@ int Counter<size, labels>::MakeHistogram(TH1* histogram) const
   return 0;
 }
 
+template <const unsigned int size, const char* labels[size]>
+int Counter<size, labels>::BindHistogram(const TH1* histogram) const
+{
+  LOG(debug) << "Binding Histogram " << histogram->GetName() << " to counter of size " << size;
+  if (size != (histogram->GetNbinsX())) {
+    LOG(fatal) << "Counter of size " << size << " does not fit in histogram " << histogram->GetName() << " with size " << histogram->GetNbinsX() - 1;
+    return 1;
+  }
+  for (unsigned int i = 0; i < size; i++) {
+    if (HasLabel(i) && strcmp(labels[i], histogram->GetXaxis()->GetBinLabel(i + 1)) != 0) { // If it has a label check its consistency!
+      LOG(fatal) << "Bin " << i + 1 << " does not have the expected label '" << histogram->GetXaxis()->GetBinLabel(i + 1) << "' vs '" << labels[i] << "'";
+      return 1;
+    }
+  }
+  mBoundHistogram = histogram;
+  return 0;
+}
+
+template <const unsigned int size, const char* labels[size]>
+template <typename T>
+void Counter<size, labels>::CopyNonEmpty(T* destination) const
+{
+  for (unsigned int i = 0; i < size; i++) {
+    destination[i] = counter[i] > 0 ? static_cast<T>(counter[i]) : destination[i];
+  }
+}
+
 template <const unsigned int size, const char* labels[size]>
 int Counter<size, labels>::FillHistogram(TH1* histogram, const unsigned int& biny, const unsigned int& binz) const
 {
+  LOG(debug) << "Filling Histogram " << histogram->GetName() << " with counter contents";
+#ifndef ENABLE_BIN_SHIFT
+  if (histogram != mBoundHistogram && BindHistogram(histogram) != 0) {
+    return 1;
+  }
+  unsigned int nonEmpty = 0;
+  for (unsigned int i = 0; i < size; i++) {
+    nonEmpty += counter[i] > 0;
+  }
+  if (nonEmpty == 0) {
+    return 0;
+  }
+  // Counter at position i goes to the bin (i + 1, biny, binz), so the target bins are contiguous in the histogram arrays
+  const int firstBin = histogram->GetBin(1, biny, binz);
+  if (auto arrayF = dynamic_cast<TArrayF*>(histogram)) {
+    CopyNonEmpty(arrayF->GetArray() + firstBin);
+  } else if (auto arrayD = dynamic_cast<TArrayD*>(histogram)) {
+    CopyNonEmpty(arrayD->GetArray() + firstBin);
+  } else if (auto arrayI = dynamic_cast<TArrayI*>(histogram)) {
+    CopyNonEmpty(arrayI->GetArray() + firstBin);
+  } else {
+    for (unsigned int i = 0; i < size; i++) {
+      if (counter[i] > 0) {
+        histogram->SetBinContent(firstBin + i, counter[i]);
+      }
+    }
+  }
+  if (histogram->GetSumw2N() > 0) {
+    CopyNonEmpty(histogram->GetSumw2()->GetArray() + firstBin);
+  }
+  // As SetBinContent would do: each filled bin is an entry and the statistics are recomputed from the bin contents
+  Double_t stats[13] = { 0 };
+  histogram->PutStats(stats);
+  histogram->SetEntries(histogram->GetEntries() + nonEmpty);
+#else
   auto fillIt = [&](const unsigned int& bin, const unsigned int& index) {
     if (counter[index] > 0) {
       if (biny > 0) {
@@ -257,22 +350,6 @@ int Counter<size, labels>::FillHistogram(TH1* histogram, const unsigned int& bin
       }
     }
   };
-
-  LOG(debug) << "Filling Histogram " << histogram->GetName() << " with counter contents";
-#ifndef ENABLE_BIN_SHIFT
-  if (size != (histogram->GetNbinsX())) {
-    LOG(fatal) << "Counter of size " << size << " does not fit in histogram " << histogram->GetName() << " with size " << histogram->GetNbinsX() - 1;
-    return 1;
-  }
-  for (unsigned int i = 0; i < size; i++) {
-    LOG(debug) << "Filling bin " << i + 1 << " with counter at position " << i;
-    if (HasLabel(i) && strcmp(labels[i], histogram->GetXaxis()->GetBinLabel(i + 1)) != 0) { // If it has a label check its consistency!
-      LOG(fatal) << "Bin " << i + 1 << " does not have the expected label '" << histogram->GetXaxis()->GetBinLabel(i + 1) << "' vs '" << labels[i] << "'";
-      return 1;
-    }
-    fillIt(i + 1, i);
-  }
-#else
   const unsigned int nbinsx = histogram->GetNbinsX();
   if constexpr (labels == nullptr) { // Fill without labels
     if (nbinsx < size) {
@@ -332,16 +409,10 @@ int Counter<size, labels>::AddHistogram(TH1* histogram, const float& weight) con
 
   LOG(debug) << "Filling Histogram " << histogram->GetName() << " with counter contents";
 #ifndef ENABLE_BIN_SHIFT
-  if (size != (histogram->GetNbinsX())) {
-    LOG(fatal) << "Counter of size " << size << " does not fit in histogram " << histogram->GetName() << " with size " << histogram->GetNbinsX() - 1;
+  if (histogram != mBoundHistogram && BindHistogram(histogram) != 0) {
     return 1;
   }
   for (unsigned int i = 0; i < size; i++) {
-    LOG(debug) << "Filling bin " << i + 1 << " with counter at position " << i;
-    if (HasLabel(i) && strcmp(labels[i], histogram->GetXaxis()->GetBinLabel(i + 1)) != 0) { // If it has a label check its consistency!
-      LOG(fatal) << "Bin " << i + 1 << " does not have the expected label '" << histogram->GetXaxis()->GetBinLabel(i + 1) << "' vs '" << labels[i] << "'";
-      return 1;
-    }
     fillIt(i + 1, i);
   }
 #else
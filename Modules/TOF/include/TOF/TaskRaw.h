@@ -31,6 +31,9 @@ using namespace o2::tof::compressed;
 // QC includes
 #include "QualityControl/TaskInterface.h"
 #include "Base/Counter.h"
+
+#include <memory>
+#include <vector>
 using namespace o2::quality_control::core;
 
 class TH1;
@@ -98,6 +101,14 @@ class RawDataDecoder final : public DecoderBase
   /// Function to reset histograms
   void resetHistograms();
 
+  /// Function to reset the diagnostic counters of the crates (RDH, DRM, LTM, TRM)
+  void resetDiagnosticCounters();
+
+  /// Function to add the counters and histograms filled by another decoder, e.g. one running in a worker thread.
+  /// The merged content of the other decoder is reset afterwards, so that it is not counted twice.
+  /// Per-TF counters (RDH open) and the ones filled only at the end of the cycle are not merged.
+  void merge(RawDataDecoder& other);
+
   // Function for noise estimation
   void estimateNoise(std::shared_ptr<TH1F> hIndexEOIsNoise);
 
@@ -177,6 +188,13 @@ class TaskRaw final : public TaskInterface
   std::shared_ptr<TH1F> mHistoTimeBC; /// Time in Bunch Crossing
 
   RawDataDecoder mDecoderRaw; /// Decoder for TOF Compressed data useful for the Task and filler of histograms for compressed raw data
+
+  // Parallel decoding
+  /// Decoders running in worker threads, each one processing the payloads of a subset of crates.
+  /// Their content is merged into mDecoderRaw at the end of the cycle. Empty when decoding in the main thread.
+  std::vector<std::unique_ptr<RawDataDecoder>> mDecoderWorkers;
+  /// Payloads of the current TF, assigned to the worker decoders according to the crate
+  std::vector<std::vector<std::pair<const char*, size_t>>> mWorkerPayloads;
 };
 
 } // namespace o2::quality_control_modules::tof
@@ -24,6 +24,9 @@
 #include <TH1F.h>
 #include <TH2F.h>
 #include <TEfficiency.h>
+#include <TROOT.h>
+
+#include <future>
 
 // O2 includes
 #include "DataFormatsTOF/CompressedDataFormat.h"
@@ -266,6 +269,56 @@ void RawDataDecoder::resetHistograms() // Reset of histograms in Decoder
   mHistoIndexEOHitRate->Reset();
 }
 
+void RawDataDecoder::resetDiagnosticCounters()
+{
+  for (unsigned int i = 0; i < ncrates; i++) {
+    mCounterRDH[i].Reset();
+    mCounterDRM[i].Reset();
+    mCounterLTM[i].Reset();
+    for (unsigned int j = 0; j < ntrms; j++) {
+      mCounterTRM[i][j].Reset();
+    }
+  }
+}
+
+void RawDataDecoder::merge(RawDataDecoder& other)
+{
+  // Merge counters
+  for (unsigned int i = 0; i < ncrates; i++) {
+    mCounterRDH[i].Merge(other.mCounterRDH[i]);
+    mCounterDRM[i].Merge(other.mCounterDRM[i]);
+    mCounterLTM[i].Merge(other.mCounterLTM[i]);
+    for (unsigned int j = 0; j < ntrms; j++) {
+      mCounterTRM[i][j].Merge(other.mCounterTRM[i][j]);
+    }
+  }
+  mCounterIndexEO.Merge(other.mCounterIndexEO);
+  mCounterIndexEOInTimeWin.Merge(other.mCounterIndexEOInTimeWin);
+  mCounterTimeBC.Merge(other.mCounterTimeBC);
+  mCounterRDHTriggers[0].Merge(other.mCounterRDHTriggers[0]);
+  mCounterRDHTriggers[1].Merge(other.mCounterRDHTriggers[1]);
+
+  // Merge histograms
+  mHistoHits->Add(other.mHistoHits.get());
+  if (mDebugCrateMultiplicity) {
+    for (unsigned int i = 0; i < ncrates; i++) {
+      mHistoHitsCrate[i]->Add(other.mHistoHitsCrate[i].get());
+    }
+  }
+  mHistoTime->Add(other.mHistoTime.get());
+  mHistoTOT->Add(other.mHistoTOT.get());
+  mHistoDiagnostic->Add(other.mHistoDiagnostic.get());
+  mHistoNErrors->Add(other.mHistoNErrors.get());
+  mHistoErrorBits->Add(other.mHistoErrorBits.get());
+  mHistoError->Add(other.mHistoError.get());
+  mHistoNTests->Add(other.mHistoNTests.get());
+  mHistoTest->Add(other.mHistoTest.get());
+  mHistoOrbitID->Add(other.mHistoOrbitID.get());
+
+  other.resetDiagnosticCounters();
+  other.resetHistograms();
+}
+
 void RawDataDecoder::estimateNoise(std::shared_ptr<TH1F> hIndexEOIsNoise)
 {
   double IntegratedTimeFea[nstrips][ncrates][4] = { { { 0. } } };
@@ -354,24 +407,38 @@ void TaskRaw::initialize(o2::framework::InitContext& /*ctx*/)
 {
   // Set task parameters from JSON
   bool useConetMode = false;
-  if (utils::parseBooleanParameter(mCustomParameters, "DecoderCONET", useConetMode)) {
+  const bool hasConetMode = utils::parseBooleanParameter(mCustomParameters, "DecoderCONET", useConetMode);
+  if (hasConetMode) {
     ILOG(Info, Support) << "Set DecoderCONET to " << useConetMode << ENDM;
-    mDecoderRaw.setDecoderCONET(useConetMode);
-  }
-  if (auto param = mCustomParameters.find("TimeWindowMin"); param != mCustomParameters.end()) {
-    mDecoderRaw.setTimeWindowMin(param->second);
-  }
-  if (auto param = mCustomParameters.find("TimeWindowMax"); param != mCustomParameters.end()) {
-    mDecoderRaw.setTimeWindowMax(param->second);
-  }
-  if (auto param = mCustomParameters.find("NoiseThreshold"); param != mCustomParameters.end()) {
-    mDecoderRaw.setNoiseThreshold(param->second);
   }
   bool usePerCrateHistograms = false;
-  if (utils::parseBooleanParameter(mCustomParameters, "DebugCrateMultiplicity", usePerCrateHistograms)) {
+  const bool hasPerCrateHistograms = utils::parseBooleanParameter(mCustomParameters, "DebugCrateMultiplicity", usePerCrateHistograms);
+  if (hasPerCrateHistograms) {
     ILOG(Info, Support) << "Set DebugCrateMultiplicity to " << usePerCrateHistograms << ENDM;
-    mDecoderRaw.setDebugCrateMultiplicity(usePerCrateHistograms);
   }
+  int decoderThreads = 1;
+  if (utils::parseIntParameter(mCustomParameters, "DecoderThreads", decoderThreads) && decoderThreads > 1) {
+    ILOG(Info, Support) << "Decoding payloads of different crates in " << decoderThreads << " threads" << ENDM;
+    ROOT::EnableThreadSafety();
+  }
+  auto configureDecoder = [&](RawDataDecoder& decoder) {
+    if (hasConetMode) {
+      decoder.setDecoderCONET(useConetMode);
+    }
+    if (auto param = mCustomParameters.find("TimeWindowMin"); param != mCustomParameters.end()) {
+      decoder.setTimeWindowMin(param->second);
+    }
+    if (auto param = mCustomParameters.find("TimeWindowMax"); param != mCustomParameters.end()) {
+      decoder.setTimeWindowMax(param->second);
+    }
+    if (auto param = mCustomParameters.find("NoiseThreshold"); param != mCustomParameters.end()) {
+      decoder.setNoiseThreshold(param->second);
+    }
+    if (hasPerCrateHistograms) {
+      decoder.setDebugCrateMultiplicity(usePerCrateHistograms);
+    }
+  };
+  configureDecoder(mDecoderRaw);
 
   // RDH
   mHistoRDH = std::make_shared<TH2F>("RDHCounter", "RDH Diagnostics;RDH Word;Crate;Words",
@@ -469,6 +536,20 @@ void TaskRaw::initialize(o2::framework::InitContext& /*ctx*/)
   getObjectsManager()->startPublishing(mDecoderRaw.mHistoOrbitID.get());
   getObjectsManager()->startPublishing(mDecoderRaw.mHistoNoiseMap.get());
   getObjectsManager()->startPublishing(mDecoderRaw.mHistoIndexEOHitRate.get());
+
+  // Worker decoders fill their own histograms, which are not published but merged into the ones of mDecoderRaw
+  mDecoderWorkers.clear();
+  if (decoderThreads > 1) {
+    const auto addDirectoryStatus = TH1::AddDirectoryStatus();
+    TH1::AddDirectory(kFALSE);
+    for (int i = 0; i < decoderThreads; i++) {
+      auto& worker = mDecoderWorkers.emplace_back(std::make_unique<RawDataDecoder>());
+      configureDecoder(*worker);
+      worker->initHistograms();
+    }
+    TH1::AddDirectory(addDirectoryStatus);
+  }
+  mWorkerPayloads.resize(mDecoderWorkers.size());
 }
 
 void TaskRaw::startOfActivity(Activity& /*activity*/)
@@ -488,7 +569,35 @@ void TaskRaw::monitorData(o2::framework::ProcessingContext& ctx)
   // Reset counter before decode() call
   mDecoderRaw.mCounterRDHOpen.Reset();
   //
-  {
+  if (!mDecoderWorkers.empty()) {
+    // Payloads of one crate always go to the same worker, each worker has its own counters and histograms
+    for (auto& payloads : mWorkerPayloads) {
+      payloads.clear();
+    }
+    for (auto const& input : o2::framework::InputRecordWalker(ctx.inputs())) {
+      const auto payloadIn = input.payload;
+      const auto payloadInSize = o2::framework::DataRefUtils::getPayloadSize(input);
+      const unsigned int crate = payloadInSize >= sizeof(o2::header::RAWDataHeader) ? (RDHUtils::getFEEID(payloadIn) & 0xFF) : 0;
+      mWorkerPayloads[crate % mDecoderWorkers.size()].emplace_back(payloadIn, payloadInSize);
+    }
+    std::vector<std::future<void>> jobs;
+    for (size_t i = 0; i < mDecoderWorkers.size(); i++) {
+      jobs.push_back(std::async(std::launch::async, [&decoder = *mDecoderWorkers[i], &payloads = mWorkerPayloads[i]]() {
+        decoder.mCounterRDHOpen.Reset();
+        for (const auto& [payload, payloadSize] : payloads) {
+          decoder.setDecoderBuffer(payload);
+          decoder.setDecoderBufferSize(payloadSize);
+          decoder.decode();
+        }
+      }));
+    }
+    for (auto& job : jobs) {
+      job.get();
+    }
+    for (const auto& worker : mDecoderWorkers) {
+      mDecoderRaw.mCounterRDHOpen.Merge(worker->mCounterRDHOpen);
+    }
+  } else {
     /** loop over input parts **/
     for (auto const& input : o2::framework::InputRecordWalker(ctx.inputs())) {
       /** input **/
@@ -516,6 +625,9 @@ void TaskRaw::monitorData(o2::framework::ProcessingContext& ctx)
 void TaskRaw::endOfCycle()
 {
   ILOG(Info, Support) << "endOfCycle" << ENDM;
+  for (auto& worker : mDecoderWorkers) { // Summing up what was decoded in the worker threads
+    mDecoderRaw.merge(*worker);
+  }
   for (unsigned int crate = 0; crate < RawDataDecoder::ncrates; crate++) { // Filling histograms only at the end of the cycle
     mDecoderRaw.mCounterRDH[crate].FillHistogram(mHistoRDH.get(), crate + 1);
     mDecoderRaw.mCounterDRM[crate].FillHistogram(mHistoDRM.get(), crate + 1);
@@ -594,6 +706,10 @@ void TaskRaw::reset()
   mHistoRDHReceived->Reset();
 
   mDecoderRaw.resetHistograms();
+  for (auto& worker : mDecoderWorkers) {
+    worker->resetDiagnosticCounters();
+    worker->resetHistograms();
+  }
 }
 
 const char* RawDataDecoder::RDHDiagnosticsName[RawDataDecoder::nRDHwords] = { "RDH_HAS_DATA", "RDH_DECODER_FATAL", "RDH_TRIGGER_ERROR" };
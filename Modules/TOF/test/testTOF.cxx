@@ -18,6 +18,8 @@
 #include "Base/Counter.h"
 #include "DataFormatsTOF/CompressedDataFormat.h"
 #include "TH1F.h"
+#include "TH2F.h"
+#include "TMath.h"
 
 #define BOOST_TEST_MODULE Publisher test
 #define BOOST_TEST_MAIN
@@ -99,4 +101,37 @@ BOOST_AUTO_TEST_CASE(check_tof_counter)
   BOOST_TEST_CHECKPOINT("Ending");
   BOOST_CHECK(true);
 }
+
+BOOST_AUTO_TEST_CASE(check_tof_counter_2d)
+{
+  TH2F* h2D = new TH2F("h2D", "h2D;DRM Word;Crate", 32, 0, 32, 3, 0, 3);
+  Counter<32, o2::tof::diagnostic::DRMDiagnosticName> counters[3];
+  BOOST_CHECK(counters[0].MakeHistogram(h2D) == 0);
+
+  for (unsigned int crate = 0; crate < 3; crate++) {
+    for (unsigned int j = 0; j < 32; j++) {
+      counters[crate].Add(j, crate * 100 + j);
+    }
+  }
+  // Counters filled in different threads are summed up
+  Counter<32, o2::tof::diagnostic::DRMDiagnosticName> other;
+  other.Add(5, 10);
+  counters[1].Merge(other);
+  BOOST_CHECK_EQUAL(counters[1].HowMany(5), 115);
+
+  for (unsigned int crate = 0; crate < 3; crate++) {
+    BOOST_CHECK(counters[crate].FillHistogram(h2D, crate + 1) == 0);
+  }
+  for (unsigned int crate = 0; crate < 3; crate++) {
+    for (unsigned int j = 0; j < 32; j++) {
+      const double expected = counters[crate].HowMany(j);
+      BOOST_CHECK_EQUAL(h2D->GetBinContent(j + 1, crate + 1), expected);
+      BOOST_CHECK_CLOSE(h2D->GetBinError(j + 1, crate + 1), TMath::Sqrt(expected), 1e-4);
+    }
+  }
+  // 95 bins are non empty, the first one of the first crate is zero
+  BOOST_CHECK_EQUAL(h2D->GetEntries(), 95);
+  BOOST_CHECK_EQUAL(h2D->Integral(), 3 * (32 * 31 / 2) + 100 * 32 + 200 * 32 + 10);
+}
+
 } // namespace o2::quality_control_modules::tof
\ No newline at end of file
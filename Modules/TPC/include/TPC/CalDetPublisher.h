@@ -19,6 +19,7 @@
 
 // QC includes
 #include "QualityControl/PostProcessingInterface.h"
+#include "TPC/CcdbChangeTracker.h"
 
 #include <boost/property_tree/ptree_fwd.hpp>
 #include <map>
@@ -79,6 +80,8 @@ class CalDetPublisher final : public quality_control::postprocessing::PostProces
   long mInitRefNoiseTimestamp;                                           ///< timestamp of the noise data used at init of the task
   TPaveText* mNewZSCalibMsg = nullptr;                                   ///< badge to indicate the necessity to upload new calibration data for ZS
   std::unordered_map<std::string, std::vector<float>> mRanges;           ///< histogram ranges configurable via config file
+  std::vector<size_t> mCalMapSizes{};                                    ///< number of CalDet objects in each map of mOutputListMap
+  CcdbChangeTracker mChangeTracker;                                      ///< tells which CalDet objects changed since the last update
 };
 
 } // namespace o2::quality_control_modules::tpc
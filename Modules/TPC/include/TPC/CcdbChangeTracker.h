@@ -0,0 +1,77 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   CcdbChangeTracker.h
+///
+
+#ifndef QUALITYCONTROL_CCDBCHANGETRACKER_H
+#define QUALITYCONTROL_CCDBCHANGETRACKER_H
+
+// O2 includes
+#include "CCDB/CcdbApi.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace o2::quality_control_modules::tpc
+{
+
+/// \brief Tells which CCDB objects changed since they were last seen, without downloading them.
+///
+/// Only the headers of the objects are retrieved, concurrently, and their ETag is compared to the one seen at
+/// the previous call. A post-processing task can then download and redraw only the objects which changed.
+/// Each request slot has its own CcdbApi, which can also be used to download the object of this slot
+/// concurrently with the other ones.
+class CcdbChangeTracker
+{
+ public:
+  struct Request {
+    std::string path;
+    std::map<std::string, std::string> metadata{};
+    long timestamp = -1;
+  };
+
+  void init(const std::string& host);
+
+  /// \brief Checks the objects of the requests concurrently.
+  /// \return for each request, true if the object is new or changed, or if its headers could not be retrieved
+  std::vector<bool> checkForChanges(const std::vector<Request>& requests);
+
+  /// \brief Compares the ETag in the headers of an object to the one seen at the previous call and remembers it
+  /// \return true if the object is new or changed, or if the headers have no ETag
+  bool checkHeaders(const std::string& path, const std::map<std::string, std::string>& headers);
+
+  /// \brief Forgets the object at this path, e.g. because its download failed, so that it is seen as changed next time
+  void forget(const std::string& path);
+
+  /// \brief Returns the CcdbApi of a request slot, the slots are created by checkForChanges()
+  o2::ccdb::CcdbApi& getApi(size_t slot) { return *mApis.at(slot); }
+
+  /// \brief Downloads the object of a request with the CcdbApi of its slot
+  template <typename T>
+  std::unique_ptr<T> retrieve(size_t slot, const Request& request)
+  {
+    return std::unique_ptr<T>(getApi(slot).retrieveFromTFileAny<T>(request.path, request.metadata, request.timestamp));
+  }
+
+ private:
+  std::string mHost;
+  std::vector<std::unique_ptr<o2::ccdb::CcdbApi>> mApis;    ///< one CcdbApi per request slot, they are not shared between threads
+  std::unordered_map<std::string, std::string> mLastETags; ///< ETag of the object last seen at each path
+};
+
+} // namespace o2::quality_control_modules::tpc
+
+#endif // QUALITYCONTROL_CCDBCHANGETRACKER_H
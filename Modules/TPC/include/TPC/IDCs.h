@@ -21,10 +21,10 @@
 #include "TPCCalibration/IDCContainer.h"
 #include "TPCCalibration/IDCCCDBHelper.h"
 #include "TPCCalibration/IDCGroupHelperSector.h"
-#include "CCDB/CcdbApi.h"
 
 // QC includes
 #include "QualityControl/PostProcessingInterface.h"
+#include "TPC/CcdbChangeTracker.h"
 
 // ROOT includes
 #include "TCanvas.h"
@@ -71,7 +71,11 @@ class IDCs : public quality_control::postprocessing::PostProcessingInterface
 
  private:
   o2::tpc::IDCCCDBHelper<float> mCCDBHelper;
-  o2::ccdb::CcdbApi mCdbApi;
+  CcdbChangeTracker mChangeTracker;                     ///< tells which IDC objects changed since the last update
+  std::unique_ptr<o2::tpc::IDCZero> mIDCZero;           ///< last IDC0 object, kept until it changes in the CCDB
+  std::unique_ptr<o2::tpc::IDCDelta<float>> mIDCDelta;  ///< last IDCDelta object, kept until it changes in the CCDB
+  std::unique_ptr<o2::tpc::IDCOne> mIDCOne;             ///< last IDC1 object, kept until it changes in the CCDB
+  std::unique_ptr<o2::tpc::FourierCoeff> mFourierCoeff; ///< last Fourier coefficients, kept until they change in the CCDB
   std::string mHost;
   std::unique_ptr<TCanvas> mIDCZeroSides;
   std::unique_ptr<TCanvas> mIDCZeroRadialProf;
@@ -30,6 +30,7 @@
 
 #include <fmt/format.h>
 #include <algorithm>
+#include <numeric>
 
 using namespace o2::quality_control::postprocessing;
 
@@ -39,6 +40,7 @@ namespace o2::quality_control_modules::tpc
 void CalDetPublisher::configure(std::string name, const boost::property_tree::ptree& config)
 {
   o2::tpc::CDBInterface::instance().setURL(config.get<std::string>("qc.config.conditionDB.url"));
+  mChangeTracker.init(config.get<std::string>("qc.config.conditionDB.url"));
 
   for (const auto& output : config.get_child("qc.postprocessing." + name + ".outputCalPadMaps")) {
     mOutputListMap.emplace_back(output.second.data());
@@ -147,6 +149,7 @@ void CalDetPublisher::initialize(Trigger, framework::ServiceRegistry&)
     auto& calMap = o2::tpc::CDBInterface::instance().getSpecificObjectFromCDB<std::unordered_map<std::string, o2::tpc::CalDet<float>>>(fmt::format("TPC/Calib/{}", type).data(),
                                                                                                                                        -1,
                                                                                                                                        std::map<std::string, std::string>());
+    mCalMapSizes.emplace_back(calMap.size());
     for (const auto& item : calMap) {
       mCalDetCanvasVec.emplace_back(std::vector<std::unique_ptr<TCanvas>>());
       addAndPublish(getObjectsManager(),
@@ -198,13 +201,43 @@ void CalDetPublisher::update(Trigger t, framework::ServiceRegistry&)
 {
   ILOG(Info, Support) << "Trigger type is: " << t.triggerType << ", the timestamp is " << t.timestamp << ENDM;
 
+  // the headers of all the objects are checked first, only the ones which changed are downloaded and redrawn
+  std::vector<CcdbChangeTracker::Request> requests;
+  for (size_t i = 0; i < mOutputListMap.size(); i++) {
+    requests.push_back({ fmt::format("TPC/Calib/{}", mOutputListMap[i]),
+                         mLookupMaps.size() > 1 ? mLookupMaps.at(i) : mLookupMaps.at(0),
+                         mTimestamps.size() > 0 ? mTimestamps.at(i) : -1 });
+  }
+  auto calDetIndex = std::accumulate(mCalMapSizes.begin(), mCalMapSizes.end(), size_t(0));
+  for (const auto& type : mOutputList) {
+    requests.push_back({ fmt::format("TPC/Calib/{}", type),
+                         mLookupMaps.size() > 1 ? mLookupMaps.at(calDetIndex) : mLookupMaps.at(0),
+                         mTimestamps.size() > 0 ? mTimestamps.at(calDetIndex) : -1 });
+    calDetIndex++;
+  }
+  const auto changed = mChangeTracker.checkForChanges(requests);
+  size_t request = 0;
+
   auto calDetIter = 0;
   auto calVecIter = 0;
   for (const auto& type : mOutputListMap) {
-    auto& calMap = o2::tpc::CDBInterface::instance().getSpecificObjectFromCDB<std::unordered_map<std::string, o2::tpc::CalDet<float>>>(
-      fmt::format("TPC/Calib/{}", type).data(),
-      mTimestamps.size() > 0 ? mTimestamps.at(calVecIter) : -1,
-      mLookupMaps.size() > 1 ? mLookupMaps.at(calVecIter) : mLookupMaps.at(0));
+    const auto slot = request++;
+    if (!changed.at(slot)) {
+      ILOG(Debug, Support) << "TPC/Calib/" << type << " did not change, its canvases are not redrawn" << ENDM;
+      calDetIter += mCalMapSizes.at(calVecIter);
+      calVecIter++;
+      continue;
+    }
+    // the object is downloaded from the same CCDB as its headers, its ETag is forgotten if this fails so that it is retried next time
+    const auto retrieved = mChangeTracker.retrieve<std::unordered_map<std::string, o2::tpc::CalDet<float>>>(slot, requests[slot]);
+    if (!retrieved) {
+      ILOG(Warning, Support) << "Could not retrieve " << requests[slot].path << ENDM;
+      mChangeTracker.forget(requests[slot].path);
+      calDetIter += mCalMapSizes.at(calVecIter);
+      calVecIter++;
+      continue;
+    }
+    const auto& calMap = *retrieved;
     for (const auto& item : calMap) {
       auto vecPtr = toVector(mCalDetCanvasVec.at(calDetIter));
       o2::tpc::painter::makeSummaryCanvases(item.second, int(mRanges[item.second.getName()].at(0)), mRanges[item.second.getName()].at(1), mRanges[item.second.getName()].at(2), false, &vecPtr);
@@ -237,9 +270,20 @@ void CalDetPublisher::update(Trigger t, framework::ServiceRegistry&)
   }
 
   for (const auto& type : mOutputList) {
-    auto& calDet = o2::tpc::CDBInterface::instance().getSpecificObjectFromCDB<o2::tpc::CalDet<float>>(fmt::format("TPC/Calib/{}", type).data(),
-                                                                                                      mTimestamps.size() > 0 ? mTimestamps.at(calDetIter) : -1,
-                                                                                                      mLookupMaps.size() > 1 ? mLookupMaps.at(calDetIter) : mLookupMaps.at(0));
+    const auto slot = request++;
+    if (!changed.at(slot)) {
+      ILOG(Debug, Support) << "TPC/Calib/" << type << " did not change, its canvases are not redrawn" << ENDM;
+      calDetIter++;
+      continue;
+    }
+    const auto retrieved = mChangeTracker.retrieve<o2::tpc::CalDet<float>>(slot, requests[slot]);
+    if (!retrieved) {
+      ILOG(Warning, Support) << "Could not retrieve " << requests[slot].path << ENDM;
+      mChangeTracker.forget(requests[slot].path);
+      calDetIter++;
+      continue;
+    }
+    auto& calDet = *retrieved;
     auto vecPtr = toVector(mCalDetCanvasVec.at(calDetIter));
     o2::tpc::painter::makeSummaryCanvases(calDet, int(mRanges[calDet.getName()].at(0)), mRanges[calDet.getName()].at(1), mRanges[calDet.getName()].at(2), false, &vecPtr);
     calDetIter++;
@@ -0,0 +1,73 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   CcdbChangeTracker.cxx
+///
+
+// QC includes
+#include "QualityControl/QcInfoLogger.h"
+#include "TPC/CcdbChangeTracker.h"
+
+#include <future>
+
+namespace o2::quality_control_modules::tpc
+{
+
+void CcdbChangeTracker::init(const std::string& host)
+{
+  mHost = host;
+  mApis.clear();
+  mLastETags.clear();
+}
+
+std::vector<bool> CcdbChangeTracker::checkForChanges(const std::vector<Request>& requests)
+{
+  while (mApis.size() < requests.size()) {
+    mApis.emplace_back(std::make_unique<o2::ccdb::CcdbApi>());
+    mApis.back()->init(mHost);
+  }
+
+  std::vector<std::future<std::map<std::string, std::string>>> headers;
+  for (size_t slot = 0; slot < requests.size(); slot++) {
+    headers.push_back(std::async(std::launch::async, [&api = *mApis[slot], &request = requests[slot]]() {
+      return api.retrieveHeaders(request.path, request.metadata, request.timestamp);
+    }));
+  }
+
+  std::vector<bool> changed(requests.size(), true);
+  for (size_t slot = 0; slot < requests.size(); slot++) {
+    changed[slot] = checkHeaders(requests[slot].path, headers[slot].get());
+  }
+  return changed;
+}
+
+bool CcdbChangeTracker::checkHeaders(const std::string& path, const std::map<std::string, std::string>& headers)
+{
+  auto etag = headers.find("ETag");
+  if (etag == headers.end() || etag->second.empty()) {
+    ILOG(Warning, Support) << "Could not retrieve the ETag of " << path << ", it will be downloaded" << ENDM;
+    mLastETags.erase(path);
+    return true;
+  }
+  if (auto last = mLastETags.find(path); last != mLastETags.end() && last->second == etag->second) {
+    return false;
+  }
+  mLastETags[path] = etag->second;
+  return true;
+}
+
+void CcdbChangeTracker::forget(const std::string& path)
+{
+  mLastETags.erase(path);
+}
+
+} // namespace o2::quality_control_modules::tpc
@@ -22,8 +22,11 @@
 
 // root includes
 #include "TCanvas.h"
+#include "TROOT.h"
 
 #include <fmt/format.h>
+#include <future>
+#include <type_traits>
 
 using namespace o2::quality_control::postprocessing;
 
@@ -105,7 +108,9 @@ void IDCs::configure(std::string name, const boost::property_tree::ptree& config
 
 void IDCs::initialize(Trigger, framework::ServiceRegistry&)
 {
-  mCdbApi.init(mHost);
+  mChangeTracker.init(mHost);
+  // the changed objects are downloaded and deserialized concurrently in update()
+  ROOT::EnableThreadSafety();
 
   mIDCZeroRadialProf = std::make_unique<TCanvas>("c_sides_IDC0_radialProfile");
   mIDCZeroStacksA = std::make_unique<TCanvas>("c_GEMStacks_IDC0_1D_ASide");
@@ -134,37 +139,74 @@ void IDCs::initialize(Trigger, framework::ServiceRegistry&)
 
 void IDCs::update(Trigger, framework::ServiceRegistry&)
 {
-  auto idcZero = mCdbApi.retrieveFromTFileAny<o2::tpc::IDCZero>("TPC/Calib/IDC/IDC0", std::map<std::string, std::string>{}, mTimestamps["IDCZero"]);
-  auto idcDelta = mCdbApi.retrieveFromTFileAny<o2::tpc::IDCDelta<float>>("TPC/Calib/IDC/IDCDELTA", std::map<std::string, std::string>{}, mTimestamps["IDCDelta"]);
-  auto idcOne = mCdbApi.retrieveFromTFileAny<o2::tpc::IDCOne>("TPC/Calib/IDC/IDC1", std::map<std::string, std::string>{}, mTimestamps["IDCOne"]);
-  auto idcFFT = mCdbApi.retrieveFromTFileAny<o2::tpc::FourierCoeff>("TPC/Calib/IDC/FOURIER", std::map<std::string, std::string>{}, mTimestamps["FourierCoeffs"]);
-
-  mCCDBHelper.setIDCZero(idcZero);
-  mCCDBHelper.setIDCDelta(idcDelta);
-  mCCDBHelper.setIDCOne(idcOne);
-  mCCDBHelper.setFourierCoeffs(idcFFT);
-
-  mCCDBHelper.drawIDCZeroRadialProfile(mIDCZeroRadialProf.get(), mRanges["IDCZero"].at(0), mRanges["IDCZero"].at(1), mRanges["IDCZero"].at(2));
-  mCCDBHelper.drawIDCZeroStackCanvas(mIDCZeroStacksA.get(), o2::tpc::Side::A, "IDC0", mRanges["IDCZero"].at(0), mRanges["IDCZero"].at(1), mRanges["IDCZero"].at(2)); // rename this function to be more generic
-  mCCDBHelper.drawIDCZeroStackCanvas(mIDCZeroStacksC.get(), o2::tpc::Side::C, "IDC0", mRanges["IDCZero"].at(0), mRanges["IDCZero"].at(1), mRanges["IDCZero"].at(2));
+  enum Slot { IDCZero,
+              IDCDelta,
+              IDCOne,
+              FourierCoeffs };
+  const std::vector<CcdbChangeTracker::Request> requests{ { "TPC/Calib/IDC/IDC0", {}, mTimestamps["IDCZero"] },
+                                                          { "TPC/Calib/IDC/IDCDELTA", {}, mTimestamps["IDCDelta"] },
+                                                          { "TPC/Calib/IDC/IDC1", {}, mTimestamps["IDCOne"] },
+                                                          { "TPC/Calib/IDC/FOURIER", {}, mTimestamps["FourierCoeffs"] } };
+  const auto changed = mChangeTracker.checkForChanges(requests);
+
+  // only the objects which changed are downloaded, concurrently
+  auto retrieve = [&](auto& object, Slot slot) {
+    using Object = typename std::remove_reference_t<decltype(object)>::element_type;
+    return changed[slot] ? std::async(std::launch::async, [this, &requests, slot]() { return mChangeTracker.retrieve<Object>(slot, requests[slot]); })
+                         : std::future<std::unique_ptr<Object>>{};
+  };
+  auto idcZero = retrieve(mIDCZero, IDCZero);
+  auto idcDelta = retrieve(mIDCDelta, IDCDelta);
+  auto idcOne = retrieve(mIDCOne, IDCOne);
+  auto idcFFT = retrieve(mFourierCoeff, FourierCoeffs);
+
+  auto replace = [&](auto& object, auto& future, Slot slot) {
+    if (!future.valid()) {
+      return false;
+    }
+    auto retrieved = future.get();
+    if (!retrieved) {
+      ILOG(Warning, Support) << "Could not retrieve " << requests[slot].path << ENDM;
+      mChangeTracker.forget(requests[slot].path);
+      return false;
+    }
+    object = std::move(retrieved);
+    return true;
+  };
+  const bool newIDCZero = replace(mIDCZero, idcZero, IDCZero);
+  const bool newIDCDelta = replace(mIDCDelta, idcDelta, IDCDelta);
+  const bool newIDCOne = replace(mIDCOne, idcOne, IDCOne);
+  const bool newFourierCoeffs = replace(mFourierCoeff, idcFFT, FourierCoeffs);
+
+  if (!newIDCZero && !newIDCDelta && !newIDCOne && !newFourierCoeffs) {
+    ILOG(Debug, Support) << "The IDC objects did not change, the canvases are not redrawn" << ENDM;
+    return;
+  }
 
-  mCCDBHelper.drawIDCZeroStackCanvas(mIDCDeltaStacksA.get(), o2::tpc::Side::A, "IDCDelta", mRanges["IDCDelta"].at(0), mRanges["IDCDelta"].at(1), mRanges["IDCDelta"].at(2));
-  mCCDBHelper.drawIDCZeroStackCanvas(mIDCDeltaStacksC.get(), o2::tpc::Side::C, "IDCDelta", mRanges["IDCDelta"].at(0), mRanges["IDCDelta"].at(1), mRanges["IDCDelta"].at(2));
+  mCCDBHelper.setIDCZero(mIDCZero.get());
+  mCCDBHelper.setIDCDelta(mIDCDelta.get());
+  mCCDBHelper.setIDCOne(mIDCOne.get());
+  mCCDBHelper.setFourierCoeffs(mFourierCoeff.get());
 
-  mCCDBHelper.drawIDCOneCanvas(mIDCOneSides1D.get(), mRanges["IDCOne"].at(0), mRanges["IDCOne"].at(1), mRanges["IDCOne"].at(2));
+  if (newIDCZero) {
+    mCCDBHelper.drawIDCZeroRadialProfile(mIDCZeroRadialProf.get(), mRanges["IDCZero"].at(0), mRanges["IDCZero"].at(1), mRanges["IDCZero"].at(2));
+    mCCDBHelper.drawIDCZeroStackCanvas(mIDCZeroStacksA.get(), o2::tpc::Side::A, "IDC0", mRanges["IDCZero"].at(0), mRanges["IDCZero"].at(1), mRanges["IDCZero"].at(2)); // rename this function to be more generic
+    mCCDBHelper.drawIDCZeroStackCanvas(mIDCZeroStacksC.get(), o2::tpc::Side::C, "IDC0", mRanges["IDCZero"].at(0), mRanges["IDCZero"].at(1), mRanges["IDCZero"].at(2));
+  }
 
-  mCCDBHelper.drawFourierCoeff(mFourierCoeffsA.get(), o2::tpc::Side::A, mRanges["FourierCoeffs"].at(0), mRanges["FourierCoeffs"].at(1), mRanges["FourierCoeffs"].at(2));
-  mCCDBHelper.drawFourierCoeff(mFourierCoeffsC.get(), o2::tpc::Side::C, mRanges["FourierCoeffs"].at(0), mRanges["FourierCoeffs"].at(1), mRanges["FourierCoeffs"].at(2));
+  if (newIDCDelta) {
+    mCCDBHelper.drawIDCZeroStackCanvas(mIDCDeltaStacksA.get(), o2::tpc::Side::A, "IDCDelta", mRanges["IDCDelta"].at(0), mRanges["IDCDelta"].at(1), mRanges["IDCDelta"].at(2));
+    mCCDBHelper.drawIDCZeroStackCanvas(mIDCDeltaStacksC.get(), o2::tpc::Side::C, "IDCDelta", mRanges["IDCDelta"].at(0), mRanges["IDCDelta"].at(1), mRanges["IDCDelta"].at(2));
+  }
 
-  delete idcZero;
-  delete idcDelta;
-  delete idcOne;
-  delete idcFFT;
+  if (newIDCOne) {
+    mCCDBHelper.drawIDCOneCanvas(mIDCOneSides1D.get(), mRanges["IDCOne"].at(0), mRanges["IDCOne"].at(1), mRanges["IDCOne"].at(2));
+  }
 
-  mCCDBHelper.setIDCZero(nullptr);
-  mCCDBHelper.setIDCDelta(nullptr);
-  mCCDBHelper.setIDCOne(nullptr);
-  mCCDBHelper.setFourierCoeffs(nullptr);
+  if (newFourierCoeffs) {
+    mCCDBHelper.drawFourierCoeff(mFourierCoeffsA.get(), o2::tpc::Side::A, mRanges["FourierCoeffs"].at(0), mRanges["FourierCoeffs"].at(1), mRanges["FourierCoeffs"].at(2));
+    mCCDBHelper.drawFourierCoeff(mFourierCoeffsC.get(), o2::tpc::Side::C, mRanges["FourierCoeffs"].at(0), mRanges["FourierCoeffs"].at(1), mRanges["FourierCoeffs"].at(2));
+  }
 }
 
 void IDCs::finalize(Trigger, framework::ServiceRegistry&)
@@ -0,0 +1,75 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file   testCcdbChangeTracker.cxx
+///
+
+#include "TPC/CcdbChangeTracker.h"
+
+#define BOOST_TEST_MODULE CcdbChangeTracker test
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+namespace o2::quality_control_modules::tpc
+{
+
+BOOST_AUTO_TEST_CASE(etag_unchanged_and_changed)
+{
+  CcdbChangeTracker tracker;
+  tracker.init("");
+
+  // seen for the first time
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+  // unchanged
+  BOOST_CHECK(!tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+  // changed, then unchanged again
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"2\"" } }));
+  BOOST_CHECK(!tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"2\"" } }));
+
+  // the objects are tracked independently
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC1", { { "ETag", "\"2\"" } }));
+  BOOST_CHECK(!tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"2\"" } }));
+}
+
+BOOST_AUTO_TEST_CASE(etag_missing)
+{
+  CcdbChangeTracker tracker;
+  tracker.init("");
+
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+  // without the headers, the object has to be downloaded, now and next time
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", {}));
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "" } }));
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+  BOOST_CHECK(!tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+}
+
+BOOST_AUTO_TEST_CASE(etag_forget)
+{
+  CcdbChangeTracker tracker;
+  tracker.init("");
+
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC1", { { "ETag", "\"1\"" } }));
+  // e.g. the download failed, the object is seen as changed next time
+  tracker.forget("TPC/Calib/IDC0");
+  BOOST_CHECK(tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+  BOOST_CHECK(!tracker.checkHeaders("TPC/Calib/IDC0", { { "ETag", "\"1\"" } }));
+  BOOST_CHECK(!tracker.checkHeaders("TPC/Calib/IDC1", { { "ETag", "\"1\"" } }));
+
+  // no request, nothing to retrieve
+  BOOST_CHECK(tracker.checkForChanges({}).empty());
+}
+
+} // namespace o2::quality_control_modules::tpc
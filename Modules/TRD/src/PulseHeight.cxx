@@ -27,7 +27,8 @@
 #include <Framework/InputRecord.h>
 #include <Framework/InputRecordWalker.h>
 #include <gsl/span>
-#include <map>
+#include <algorithm>
+#include <numeric>
 #include <tuple>
 #include "DataFormatsTRD/Digit.h"
 #include "DataFormatsTRD/Tracklet64.h"
@@ -184,140 +185,70 @@ void PulseHeight::monitorData(o2::framework::ProcessingContext& ctx)
   auto digits = ctx.inputs().get<gsl::span<o2::trd::Digit>>("digits");
   auto tracklets = ctx.inputs().get<gsl::span<o2::trd::Tracklet64>>("tracklets");
   auto triggerrecords = ctx.inputs().get<gsl::span<o2::trd::TriggerRecord>>("triggers");
-  uint16_t tbsum[540][16][144];
-  std::map<std::tuple<int, int, int>, o2::trd::ArrayADC> dataMap;
+  // pads above threshold of the current trigger, sorted by detector, pad row and pad column
+  std::vector<const o2::trd::Digit*> firedPads;
+  std::array<double, 30> timeBins;
+  std::iota(timeBins.begin(), timeBins.end(), 0.);
+  std::array<double, 30> phValues;
   uint64_t digitcount = 0;
   std::vector<int> digitIndex;
   auto start = std::chrono::steady_clock::now();
   int triggercount = 0;
   for (auto& trigger : triggerrecords) {
-    uint64_t numtracklets = trigger.getNumberOfTracklets();
-    uint64_t numdigits = trigger.getNumberOfDigits();
-
-    int tbmax = 0;
-    int tbhi = 0;
-    int tblo = 0;
-
-    int det = 0;
-    int row = 0;
-    int pad = 0;
     int channel = 0;
 
-    memset(tbsum, 0, sizeof(tbsum));
-    dataMap.clear();
+    firedPads.clear();
     for (int i = trigger.getFirstDigit(); i < trigger.getFirstDigit() + trigger.getNumberOfDigits(); ++i) {
-
-      // digit comes in sorted by hcid.
-      // resort them by chamber,row, pad, this then removes the need for the map.
-      //
-      //  loop over det, pad, row?
       channel = digits[i].getChannel();
       if (channel == 0 || channel == 1 || channel == 20) {
         continue;
       }
-
-      auto adcs = digits[i].getADC();
-      det = digits[i].getDetector();
-      row = digits[i].getPadRow();
-      pad = digits[i].getPadCol();
-      int supermod = det / 30;
-
-      tbsum[det][row][pad] = digits[i].getADCsum();
-
-      if (tbsum[det][row][pad] >= 400) {
-        dataMap.insert(std::make_pair(std::make_tuple(det, row, pad), adcs));
-      } else {
-        tbsum[det][row][pad] = 0;
+      if (digits[i].getADCsum() >= 400) {
+        firedPads.push_back(&digits[i]);
       }
     } // end digitcont
 
-    // std::cout << "start updating..... trigger:" << triggercount++ << " with " << trigger.getNumberOfDigits() << " digits " << std::endl;
-    for (int d = 0; d < 540; d++) {
+    // digits come in sorted by hcid, resort them by chamber, row, pad.
+    // Pads which did not fire are empty, thus the pad-row maxima are searched only among the fired ones.
+    std::sort(firedPads.begin(), firedPads.end(), [](const o2::trd::Digit* a, const o2::trd::Digit* b) {
+      return std::make_tuple(a->getDetector(), a->getPadRow(), a->getPadCol()) < std::make_tuple(b->getDetector(), b->getPadRow(), b->getPadCol());
+    });
+
+    for (size_t i = 1; i + 1 < firedPads.size(); ++i) {
+      const o2::trd::Digit* padMax = firedPads[i];
+      const o2::trd::Digit* padLeft = firedPads[i - 1];
+      const o2::trd::Digit* padRight = firedPads[i + 1];
+      int d = padMax->getDetector();
+      int r = padMax->getPadRow();
+      int c = padMax->getPadCol();
+      // the maximum has to be surrounded by fired pads in the same pad row, away from the edges of the chamber
+      if (c < 2 || c >= 142) {
+        continue;
+      }
+      if (padLeft->getDetector() != d || padLeft->getPadRow() != r || padLeft->getPadCol() != c - 1 ||
+          padRight->getDetector() != d || padRight->getPadRow() != r || padRight->getPadCol() != c + 1) {
+        continue;
+      }
+      int tbmax = padMax->getADCsum();
+      int tblo = std::min<int>(padLeft->getADCsum(), padRight->getADCsum());
+      int tbhi = std::max<int>(padLeft->getADCsum(), padRight->getADCsum());
+      if (tbmax <= tbhi || tblo <= 400) {
+        continue;
+      }
+
       int sector = d / 30;
-      for (int r = 0; r < 16; r++) {
-        for (int c = 2; c < 142; c++) {
-          if (d == 50 && tbsum[d][r][c] > 0) {
-            // std::cout << "updating on detector 50 " << d << " " << r << " " << c-1 << "("<<tbsum[d][r][c-1]<<") -- " << d << " " << r << " " << c << "("<<tbsum[d][r][c]<<") -- " << d << " " << r << " " << c+1 <<"("<< tbsum[d][r][c+1]<< ")" << std::endl;
-          }
-          if (tbsum[d][r][c] > tbsum[d][r][c - 1] && tbsum[d][r][c] > tbsum[d][r][c + 1]) {
-            if (tbsum[d][r][c - 1] > tbsum[d][r][c + 1]) {
-              tbmax = tbsum[d][r][c];
-              tbhi = tbsum[d][r][c - 1];
-              tblo = tbsum[d][r][c + 1];
-              auto adcMax = dataMap.find(std::make_tuple(d, r, c));
-              auto adcHi = dataMap.find(std::make_tuple(d, r, c - 1));
-              auto adcLo = dataMap.find(std::make_tuple(d, r, c + 1));
-
-              if (dataMap.find(std::make_tuple(d, r, c - 2)) == dataMap.end()) {
-                if (tblo > 400) {
-                  int phVal = 0;
-                  // std::cout << "updatea " << d << " " << r << " " << c-1 << "("<<tbsum[d][r][c-1]<<") -- " << d << " " << r << " " << c << "("<<tbsum[d][r][c]<<") -- " << d << " " << r << " " << c+1 <<"("<< tbsum[d][r][c+1]<< ")" << std::endl;
-                  for (int tb = 0; tb < 30; tb++) {
-                    phVal = ((adcMax->second)[tb] + (adcHi->second)[tb] + (adcLo->second)[tb]);
-                    // TODO do we have a corresponding tracklet?
-                    mPulseHeight->Fill(tb, phVal);
-                    mPulseHeightpro->Fill(tb, phVal);
-                    mTotalPulseHeight2D->Fill(tb, phVal);
-                    mPulseHeight2DperSM[sector]->Fill(tb, phVal);
-                    mPulseHeightperchamber->Fill(tb, d, phVal);
-                  }
-                }
-              } else {
-                auto adcHiNeighbour = dataMap.find(std::make_tuple(d, r, c - 2));
-                if (tblo > 400) {
-                  // std::cout << "updateb " << d << " " << r << " " << c-1 << "("<<tbsum[d][r][c-1]<<") -- " << d << " " << r << " " << c << "("<<tbsum[d][r][c]<<") -- " << d << " " << r << " " << c+1 <<"("<< tbsum[d][r][c+1]<< ")" << std::endl;
-                  int phVal = 0;
-                  for (int tb = 0; tb < 30; tb++) {
-                    phVal = ((adcMax->second)[tb] + (adcHi->second)[tb] + (adcLo->second)[tb]);
-                    mPulseHeight->Fill(tb, phVal);
-                    mPulseHeightpro->Fill(tb, phVal);
-                    mTotalPulseHeight2D->Fill(tb, phVal);
-                    mPulseHeight2DperSM[sector]->Fill(tb, phVal);
-                    mPulseHeightperchamber->Fill(tb, d, phVal);
-                  }
-                }
-              }
-            } else {
-              tbmax = tbsum[d][r][c];
-              tbhi = tbsum[d][r][c + 1];
-              tblo = tbsum[d][r][c - 1];
-              auto adcMax = dataMap.find(std::make_tuple(d, r, c));
-              auto adcHi = dataMap.find(std::make_tuple(d, r, c + 1));
-              auto adcLo = dataMap.find(std::make_tuple(d, r, c - 1));
-              if (dataMap.find(std::make_tuple(d, r, c + 2)) == dataMap.end()) {
-
-                if (tblo > 400) {
-                  int phVal = 0;
-                  for (int tb = 0; tb < 30; tb++) {
-                    phVal = ((adcMax->second)[tb] + (adcHi->second)[tb] + (adcLo->second)[tb]);
-                    mPulseHeight->Fill(tb, phVal);
-                    mPulseHeightpro->Fill(tb, phVal);
-                    mTotalPulseHeight2D->Fill(tb, phVal);
-                    mPulseHeight2DperSM[sector]->Fill(tb, phVal);
-                    mPulseHeightperchamber->Fill(tb, d, phVal);
-                  }
-                }
-              } else {
-                auto adcHiNeighbour = dataMap.find(std::make_tuple(d, r, c + 2));
-                if (tblo > 400) {
-                  int phVal = 0;
-                  for (int tb = 0; tb < 30; tb++) {
-                    phVal = ((adcMax->second)[tb] + (adcHi->second)[tb] + (adcLo->second)[tb]);
-                    mPulseHeight->Fill(tb, phVal);
-                    mPulseHeightpro->Fill(tb, phVal);
-                    mTotalPulseHeight2D->Fill(tb, phVal);
-                    mPulseHeight2DperSM[sector]->Fill(tb, phVal);
-                    mPulseHeightperchamber->Fill(tb, d, phVal);
-                  }
-                }
-              }
-            } // end else
-          }   // end if (tbsum[d][r][c]>tbsum[d][r][c-1] && tbsum[d][r][c]>tbsum[d][r][c+1])
-        }     // end for c
-      }       // end for r
-    }         // end for d
-    // std::cout << "finishedupdating....." << std::endl;
-    dataMap.clear();
+      for (int tb = 0; tb < 30; tb++) {
+        phValues[tb] = padMax->getADC()[tb] + padLeft->getADC()[tb] + padRight->getADC()[tb];
+      }
+      // TODO do we have a corresponding tracklet?
+      mPulseHeight->FillN(timeBins.size(), timeBins.data(), phValues.data());
+      mPulseHeightpro->FillN(timeBins.size(), timeBins.data(), phValues.data(), nullptr);
+      mTotalPulseHeight2D->FillN(timeBins.size(), timeBins.data(), phValues.data(), nullptr);
+      mPulseHeight2DperSM[sector]->FillN(timeBins.size(), timeBins.data(), phValues.data());
+      for (int tb = 0; tb < 30; tb++) {
+        mPulseHeightperchamber->Fill(tb, d, phValues[tb]);
+      }
+    }
   } // end trigger event
 
   auto end = std::chrono::steady_clock::now();
@@ -343,8 +274,6 @@ void PulseHeight::monitorData(o2::framework::ProcessingContext& ctx)
     int pad = 0;
     int channel = 0;
 
-    memset(tbsum, 0, sizeof(tbsum));
-
     if (digitv.size() == 0)
       continue;
 